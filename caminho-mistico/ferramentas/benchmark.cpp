@@ -0,0 +1,608 @@
+/// Calculador de Caminho Critico
+/// Benchmark: tempo de cada fase para projetos sintéticos de vários tamanhos
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include <algorithm>    // equal, min, sort
+#include <functional>   // greater
+#include <atomic>       // atomic
+#include <chrono>       // steady_clock
+#include <cstdlib>      // atoi, atof, strtoull, malloc, free, mkstemp
+#include <cstdio>       // remove
+#include <cstring>      // strcmp
+#include <fstream>      // ofstream
+#include <iomanip>      // setw, setprecision
+#include <iostream>     // cout, cerr
+#include <new>          // bad_alloc
+#include <sstream>      // ostringstream
+#include <random>       // mt19937_64
+#include <set>          // set
+#include <string>       // string
+#include <vector>       // vector
+
+#include "cenarios.h"   // calculaCenarios
+#include "cpm.h"        // calculaCPM, Caminhos, CaminhosCriticos, MaioresCaminhos
+#include "execucao.h"   // Execucao
+#include "gerador.h"    // geraProjeto
+#include "instrumentacao.h" // picoMemoria
+#include "mistico.h"    // calculaProjeto
+#include "paralelo.h"   // Equipe, calculaCPMParalelo
+#include "parser.h"     // parseProjeto, parseExecucao, localizaExecucao
+#include "reproducao.h" // Reproducao
+#include "simulacao.h"  // simulaProjeto
+
+#if defined(CAMINHO_MISTICO_EXECUTAVEL) && !defined(_WIN32)
+#define BENCHMARK_PROCESSO
+#include <fcntl.h>      // O_WRONLY
+#include <spawn.h>      // posix_spawn
+#include <sys/wait.h>   // waitpid
+#include <unistd.h>     // close
+
+extern char **environ;
+#endif
+
+/// Alocações dinâmicas do processo (operator new substituído abaixo)
+static std::atomic<uint64_t> alocacoes(0);
+
+void *operator new(size_t n) {
+    alocacoes.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+/// Enumeração de caminhos somente até esta quantidade (cresce exponencialmente)
+const uint64_t LIMITE_CAMINHOS = 1000000;
+
+/// Saltos a dias sorteados (fases saltos e saltos/lin)
+const size_t QTDE_SALTOS = 64;
+
+/// Cálculos completos de um projeto (fases api e processo)
+const size_t QTDE_CHAMADAS = 16;
+
+typedef std::chrono::steady_clock Relogio;
+
+/// Quantidade de caminhos inicio -> fim (saturada em LIMITE_CAMINHOS + 1)
+uint64_t contaCaminhos(const Grafo &grafo) {
+    std::vector<AtvId> ordem;
+    if (!ordenaTopologica(ordem, grafo) || ATV_NULA == grafo.inicio) return 0;
+
+    std::vector<uint64_t> qtde(grafo.tamanho(), 0);
+    qtde[grafo.inicio] = 1;
+
+    for (const auto v : ordem) {
+        if (0 == qtde[v] || v == grafo.fim) continue;
+        for (auto s = grafo.sucBegin(v); s != grafo.sucEnd(v); ++s) {
+            qtde[*s] = std::min(qtde[*s] + qtde[v], LIMITE_CAMINHOS + 1);
+        }
+    }
+    return ATV_NULA == grafo.fim ? 0 : qtde[grafo.fim];
+}
+
+/// Resultado de uma fase: melhor tempo entre as repetições
+struct Fase {
+    std::string nome;
+    double ms;
+    double quantidade;  // itens processados por repetição
+    const char *unidade;
+};
+
+/// Executa a função "repeticoes" vezes e retorna o menor tempo (ms)
+template<typename F>
+double cronometra(unsigned repeticoes, F funcao) {
+    double melhor = 0;
+    for (unsigned r = 0; r < repeticoes; ++r) {
+        const auto t0 = Relogio::now();
+        funcao();
+        const auto ms = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                Relogio::now() - t0).count() / 1e6;
+        if (0 == r || ms < melhor) melhor = ms;
+    }
+    return melhor;
+}
+
+/// Verifica se o argumento é uma das opções
+bool opcao(const char *arg, const char *curta, const char *longa) {
+    return 0 == std::strcmp(arg, curta) || 0 == std::strcmp(arg, longa);
+}
+
+/// Lê uma lista de tamanhos separados por vírgula
+void leTamanhos(std::vector<uint32_t> &tamanhos, const char *lista) {
+    tamanhos.clear();
+    std::istringstream in(lista);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+        if (!item.empty()) tamanhos.push_back(static_cast<uint32_t>(std::atoi(item.c_str())));
+    }
+}
+
+#if defined(BENCHMARK_PROCESSO)
+/// Calcula um projeto em um novo processo do caminho_mistico (saída descartada)
+/// @param arquivo arquivo de entrada
+/// @return false caso o processo não possa ser criado ou termine com erro
+bool executaProcesso(const std::string &arquivo) {
+    const char *args[] = {CAMINHO_MISTICO_EXECUTAVEL, "-p", arquivo.c_str(), nullptr};
+
+    posix_spawn_file_actions_t acoes;
+    posix_spawn_file_actions_init(&acoes);
+    posix_spawn_file_actions_addopen(&acoes, 1, "/dev/null", O_WRONLY, 0);
+    posix_spawn_file_actions_addopen(&acoes, 2, "/dev/null", O_WRONLY, 0);
+
+    pid_t pid;
+    const int falha = posix_spawn(&pid, args[0], &acoes, nullptr,
+                                  const_cast<char *const *>(args), environ);
+    posix_spawn_file_actions_destroy(&acoes);
+    if (0 != falha) return false;
+
+    int estado = 0;
+    return pid == waitpid(pid, &estado, 0) && WIFEXITED(estado) && 0 == WEXITSTATUS(estado);
+}
+#endif
+
+} // namespace
+
+int main(int argc, const char *argv[]) {
+
+    // -n / --tamanhos N1,N2,...: quantidades de atividades
+    // -d / --densidade X: conexões extras por atividade (média)
+    // -f / --forma F: cadeia, leque, camadas ou serie-paralelo
+    // -l / --dias N: dias da terceira seção (0: até o fim da execução)
+    // -a / --atraso N: atraso máximo sorteado por início/término (dias)
+    // -r / --repeticoes N: repetições de cada fase (vale o menor tempo)
+    // -j / --threads N: cronograma e leitura dos dias com 1, 2, 4, ..., N threads
+    // -s / --simulacao N: Monte Carlo com N amostras (estimativas de três pontos)
+    // -c / --cenarios N: lote de N cenários de duração (0: omite)
+    std::vector<uint32_t> tamanhos = {1000, 10000};
+    ParametrosGerador parametros;
+    parametros.densidade = 1.0;
+    unsigned repeticoes = 3;
+    unsigned maxThreads = 0;
+    uint64_t amostras = 0;
+    size_t qtdeCenarios = 64;
+    size_t qtdeMaiores = 100;
+    bool argsValidos = true;
+
+    for (int i = 1; i < argc; ++i) {
+        const bool temValor = i + 1 < argc;
+
+        if (opcao(argv[i], "-n", "--tamanhos") && temValor) {
+            leTamanhos(tamanhos, argv[++i]);
+        } else if (opcao(argv[i], "-d", "--densidade") && temValor) {
+            parametros.densidade = std::atof(argv[++i]);
+        } else if (opcao(argv[i], "-f", "--forma") && temValor) {
+            argsValidos = argsValidos && leForma(argv[++i], parametros.forma);
+        } else if (opcao(argv[i], "-l", "--dias") && temValor) {
+            parametros.dias = static_cast<uint32_t>(std::atoi(argv[++i]));
+        } else if (opcao(argv[i], "-a", "--atraso") && temValor) {
+            parametros.atrasoMaximo = std::atoi(argv[++i]);
+        } else if (opcao(argv[i], "-r", "--repeticoes") && temValor) {
+            repeticoes = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+        } else if (opcao(argv[i], "-s", "--simulacao") && temValor) {
+            amostras = std::strtoull(argv[++i], nullptr, 10);
+            parametros.tresPontos = true;
+        } else if (opcao(argv[i], "-c", "--cenarios") && temValor) {
+            qtdeCenarios = static_cast<size_t>(std::max(0, std::atoi(argv[++i])));
+        } else if (opcao(argv[i], "-k", "--maiores") && temValor) {
+            qtdeMaiores = static_cast<size_t>(std::max(0, std::atoi(argv[++i])));
+        } else if (opcao(argv[i], "-j", "--threads") && temValor) {
+            maxThreads = static_cast<unsigned>(std::max(0, std::atoi(argv[++i])));
+        } else {
+            argsValidos = false;
+        }
+    }
+
+    if (!argsValidos || tamanhos.empty()) {
+        std::cerr << "ERRO: argumentos invalidos. Tente:\n"
+                  << "$ " << argv[0]
+                  << " [-n 1000,10000,...] [-d densidade]"
+                     " [-f cadeia|leque|camadas|serie-paralelo] [-l dias] [-a atraso] [-r repeticoes]"
+                     " [-j threads] [-s amostras] [-c cenarios] [-k maiores]\n";
+        return EXIT_FAILURE;
+    }
+
+    if (qtdeCenarios > 0) {
+        std::cout << "cenarios: " << qtdeCenarios << " por lote (" << instrucoesCenarios() << ")\n";
+    }
+
+    std::cout << std::left << std::setw(12) << "atividades"
+              << std::setw(11) << "fase"
+              << std::right << std::setw(12) << "tempo(ms)"
+              << std::setw(16) << "vazao"
+              << "  unidade" << std::setw(18) << "pico(KiB)" << "\n";
+
+    for (const auto n : tamanhos) {
+        parametros.atividades = n;
+
+        std::ostringstream texto;
+        geraProjeto(texto, parametros);
+        const auto arquivo = texto.str();
+
+        std::vector<Fase> fases;
+
+        // Leitura (três seções)
+        Projeto projeto;
+        ErroParse erro;
+        bool ok = true;
+
+        fases.push_back(Fase{"leitura", cronometra(repeticoes, [&]() {
+            projeto = Projeto();
+            ok = parseProjeto(projeto, arquivo.data(), arquivo.size(), erro);
+        }), arquivo.size() / 1e6, "MB/s"});
+
+        // Alocações de uma leitura (fora do cronômetro)
+        const auto alocacoesAntes = alocacoes.load();
+        {
+            Projeto outro;
+            parseProjeto(outro, arquivo.data(), arquivo.size(), erro);
+        }
+        const auto alocacoesLeitura = alocacoes.load() - alocacoesAntes;
+
+        if (!ok) {
+            std::cerr << "ERRO: linha " << erro.linha << ", coluna " << erro.coluna
+                      << ": " << erro.mensagem << "\n";
+            return EXIT_FAILURE;
+        }
+
+        const auto &grafo = projeto.grafo;
+        const double vertices = grafo.tamanho() + static_cast<double>(grafo.qtdeArestas());
+
+        // ES/EF/LS/LF
+        Cronograma cronograma;
+        fases.push_back(Fase{"cpm", cronometra(repeticoes, [&]() {
+            calculaCPM(cronograma, grafo);
+        }), vertices / 1e6, "M(V+E)/s"});
+
+        // ES/EF/LS/LF em paralelo: 1, 2, 4, ..., maxThreads
+        std::vector<unsigned> qtdesThreads;
+        for (unsigned t = 1; t < maxThreads; t *= 2) qtdesThreads.push_back(t);
+        if (maxThreads > 0) qtdesThreads.push_back(maxThreads);
+
+        for (const auto t : qtdesThreads) {
+            Equipe equipe(t);
+            Cronograma paralelo;
+            fases.push_back(Fase{"cpm/" + std::to_string(t), cronometra(repeticoes, [&]() {
+                calculaCPMParalelo(paralelo, grafo, equipe);
+            }), vertices / 1e6, "M(V+E)/s"});
+
+            if (paralelo.earlyStart != cronograma.earlyStart ||
+                paralelo.lateStart != cronograma.lateStart ||
+                paralelo.slack != cronograma.slack ||
+                paralelo.duracao != cronograma.duracao) {
+                std::cerr << "ERRO: cronograma paralelo (" << t << " threads) difere do sequencial\n";
+                return EXIT_FAILURE;
+            }
+        }
+
+        // Terceira seção em trechos paralelos: 1, 2, 4, ..., maxThreads,
+        // conferida com os dias da leitura sequencial
+        size_t inicioExecucao = 0;
+        int linhaExecucao = 0;
+        localizaExecucao(arquivo.data(), arquivo.size(), inicioExecucao, linhaExecucao);
+        const auto bytesExecucao = arquivo.size() - inicioExecucao;
+
+        for (const auto t : qtdesThreads) {
+            Equipe equipe(t);
+            std::vector<Day> dias;
+            Arena memoria;
+            fases.push_back(Fase{"dias/" + std::to_string(t), cronometra(repeticoes, [&]() {
+                dias.clear();
+                memoria.libera();
+                parseExecucao(dias, memoria, grafo, arquivo.data() + inicioExecucao,
+                              bytesExecucao, linhaExecucao, erro, equipe);
+            }), bytesExecucao / 1e6, "MB/s"});
+
+            bool iguais = dias.size() == projeto.dias.size();
+            for (size_t i = 0; iguais && i < dias.size(); ++i) {
+                const auto &a = dias[i];
+                const auto &b = projeto.dias[i];
+                iguais = a.dia == b.dia && a.iniciadas.size() == b.iniciadas.size() &&
+                         a.finalizadas.size() == b.finalizadas.size() &&
+                         std::equal(a.iniciadas.begin(), a.iniciadas.end(), b.iniciadas.begin()) &&
+                         std::equal(a.finalizadas.begin(), a.finalizadas.end(), b.finalizadas.begin());
+            }
+            if (!iguais) {
+                std::cerr << "ERRO: dias lidos com " << t << " threads diferem da leitura sequencial\n";
+                return EXIT_FAILURE;
+            }
+        }
+
+        // Lote de cenários: o primeiro repete as durações do cabeçalho, os
+        // demais sorteiam até o dobro; comparado a um calculaCPM por cenário
+        if (qtdeCenarios > 0) {
+            LoteCenarios lote;
+            lote.inicializa(grafo, qtdeCenarios);
+            std::mt19937_64 sorteio(parametros.semente);
+            for (AtvId v = 0; v < grafo.tamanho(); ++v) {
+                for (size_t c = 1; c < qtdeCenarios && grafo.peso[v] > 0; ++c) {
+                    lote.em(v, c) = 1 + static_cast<int32_t>(sorteio() % (2 * grafo.peso[v]));
+                }
+            }
+
+            ResultadoCenarios resultado;
+            fases.push_back(Fase{"cenarios", cronometra(repeticoes, [&]() {
+                calculaCenarios(resultado, grafo, lote);
+            }), qtdeCenarios * vertices / 1e6, "M(V+E)/s"});
+
+            Grafo variante = grafo;
+            Cronograma individual;
+            fases.push_back(Fase{"cenarios/1", cronometra(repeticoes, [&]() {
+                for (size_t c = 0; c < qtdeCenarios; ++c) {
+                    for (AtvId v = 0; v < grafo.tamanho(); ++v) {
+                        if (grafo.peso[v] >= 0) variante.peso[v] = lote.em(v, c);
+                    }
+                    calculaCPM(individual, variante);
+                }
+            }), qtdeCenarios * vertices / 1e6, "M(V+E)/s"});
+
+            bool iguais = resultado.duracaoProjeto[0] == cronograma.duracao &&
+                          resultado.duracaoProjeto[qtdeCenarios - 1] == individual.duracao;
+            for (AtvId v = 0; iguais && v < grafo.tamanho(); ++v) {
+                iguais = resultado.folga(v, 0) == cronograma.slack[v] &&
+                         resultado.lf(v, 0) == cronograma.lateFinish[v] &&
+                         resultado.folga(v, qtdeCenarios - 1) == individual.slack[v] &&
+                         resultado.ef(v, qtdeCenarios - 1) == individual.earlyFinish[v];
+            }
+            if (!iguais) {
+                std::cerr << "ERRO: lote de cenarios difere do calculo individual\n";
+                return EXIT_FAILURE;
+            }
+        }
+
+        // Caminhos e críticos (somente se a quantidade for tratável)
+        const auto qtdeCaminhos = contaCaminhos(grafo);
+        if (qtdeCaminhos <= LIMITE_CAMINHOS) {
+            size_t criticos = 0;
+            fases.push_back(Fase{"caminhos", cronometra(repeticoes, [&]() {
+                Caminhos caminhos(grafo);
+                std::vector<AtvId> c;
+                criticos = 0;
+                while (caminhos.proximo(c)) {
+                    int peso = 0;
+                    for (const auto v : c) {
+                        if (grafo.peso[v] > 0) peso += grafo.peso[v];
+                    }
+                    if (peso == cronograma.duracao) ++criticos;
+                }
+            }), qtdeCaminhos / 1e6, "Mcam/s"});
+        }
+
+        // k caminhos mais longos (sem enumerar todos os caminhos)
+        if (qtdeMaiores > 0) {
+            std::vector<int> duracoes;
+            std::set<std::vector<AtvId>> distintos;
+            bool validos = true;
+            fases.push_back(Fase{"maiores", cronometra(repeticoes, [&]() {
+                MaioresCaminhos maiores(grafo);
+                std::vector<AtvId> caminho;
+                int duracao = 0;
+                duracoes.clear();
+                distintos.clear();
+                while (duracoes.size() < qtdeMaiores && maiores.proximo(caminho, duracao)) {
+                    int peso = 0;
+                    for (const auto v : caminho) {
+                        if (grafo.peso[v] > 0) peso += grafo.peso[v];
+                    }
+                    validos = validos && peso == duracao && distintos.insert(caminho).second;
+                    duracoes.push_back(duracao);
+                }
+            }), duracoes.size() / 1e6, "Mcam/s"});
+
+            // Confere com a enumeração completa (quando tratável)
+            if (qtdeCaminhos <= LIMITE_CAMINHOS) {
+                std::vector<int> todas;
+                Caminhos caminhos(grafo);
+                std::vector<AtvId> c;
+                while (caminhos.proximo(c)) {
+                    int peso = 0;
+                    for (const auto v : c) {
+                        if (grafo.peso[v] > 0) peso += grafo.peso[v];
+                    }
+                    todas.push_back(peso);
+                }
+                std::sort(todas.begin(), todas.end(), std::greater<int>());
+                todas.resize(std::min(todas.size(), qtdeMaiores));
+                validos = validos && todas == duracoes;
+            }
+
+            if (!validos || (!duracoes.empty() && duracoes.front() != cronograma.duracao)) {
+                std::cerr << "ERRO: caminhos mais longos diferem da enumeracao completa\n";
+                return EXIT_FAILURE;
+            }
+        }
+
+        // Caminhos críticos: contagem + extração sob demanda (limitada)
+        uint64_t extraidos = 0;
+        fases.push_back(Fase{"criticos", cronometra(repeticoes, [&]() {
+            CaminhosCriticos criticos(grafo, cronograma);
+            std::vector<AtvId> caminho;
+            for (extraidos = 0; extraidos < LIMITE_CAMINHOS && criticos.proximo(caminho);) {
+                ++extraidos;
+            }
+        }), extraidos / 1e6, "Mcam/s"});
+
+        // Monte Carlo (uma amostra = ida + volta sobre o grafo)
+        if (amostras > 0) {
+            ParametrosSimulacao simulacao;
+            simulacao.amostras = amostras;
+            simulacao.threads = std::max(maxThreads, 1u);
+            fases.push_back(Fase{"simulacao", cronometra(repeticoes, [&]() {
+                ResultadoSimulacao resultado;
+                simulaProjeto(resultado, grafo, simulacao);
+            }), amostras / 1e3, "kamostras/s"});
+        }
+
+        // Reprodução dos dias (sem alertas)
+        fases.push_back(Fase{"execucao", cronometra(repeticoes, [&]() {
+            Execucao execucao;
+            execucao.inicializa(grafo, cronograma);
+            for (const auto &d : projeto.dias) execucao.processaDia(d, nullptr);
+        }), projeto.dias.size() / 1e3, "kdias/s"});
+
+        // Reprodução dos dias com os alertas (saída descartada)
+        fases.push_back(Fase{"alertas", cronometra(repeticoes, [&]() {
+            std::ostream descarte(nullptr);
+            Execucao execucao;
+            execucao.inicializa(grafo, cronograma);
+            for (const auto &d : projeto.dias) execucao.processaDia(d, &descarte);
+        }), projeto.dias.size() / 1e3, "kdias/s"});
+
+        // Alocações da reprodução dos dias, sem e com os alertas, depois de
+        // inicializa (fora do cronômetro)
+        uint64_t alocacoesExecucao = 0;
+        uint64_t alocacoesAlertas = 0;
+        {
+            std::ostream descarte(nullptr);
+            Execucao execucao;
+            execucao.inicializa(grafo, cronograma);
+            auto antes = alocacoes.load();
+            for (const auto &d : projeto.dias) execucao.processaDia(d, nullptr);
+            alocacoesExecucao = alocacoes.load() - antes;
+
+            execucao.inicializa(grafo, cronograma);
+            antes = alocacoes.load();
+            for (const auto &d : projeto.dias) execucao.processaDia(d, &descarte);
+            alocacoesAlertas = alocacoes.load() - antes;
+        }
+
+        // Saltos a dias sorteados: pontos de restauração x reprodução desde o
+        // início a cada salto
+        std::vector<size_t> destinos;
+        std::mt19937_64 sorteio(parametros.semente);
+        for (size_t i = 0; i < QTDE_SALTOS; ++i) {
+            destinos.push_back(static_cast<size_t>(sorteio() % (projeto.dias.size() + 1)));
+        }
+
+        fases.push_back(Fase{"saltos", cronometra(repeticoes, [&]() {
+            Reproducao reproducao;
+            reproducao.inicializa(grafo, cronograma, projeto.dias);
+            for (const auto p : destinos) reproducao.vaiPara(p);
+        }), destinos.size() / 1e3, "ksaltos/s"});
+
+        fases.push_back(Fase{"saltos/lin", cronometra(repeticoes, [&]() {
+            for (const auto p : destinos) {
+                Execucao execucao;
+                execucao.inicializa(grafo, cronograma);
+                for (size_t d = 0; d < p; ++d) execucao.processaDia(projeto.dias[d], nullptr);
+            }
+        }), destinos.size() / 1e3, "ksaltos/s"});
+
+        // Confere cada salto com a reprodução desde o início
+        {
+            Reproducao reproducao;
+            reproducao.inicializa(grafo, cronograma, projeto.dias, 8);
+            bool iguais = true;
+            for (const auto p : destinos) {
+                reproducao.vaiPara(p);
+
+                Execucao execucao;
+                execucao.inicializa(grafo, cronograma);
+                for (size_t d = 0; d < p; ++d) execucao.processaDia(projeto.dias[d], nullptr);
+
+                const auto &a = reproducao.execucao().escalonador();
+                const auto &b = execucao.escalonador();
+                iguais = iguais && reproducao.execucao().dia() == execucao.dia() &&
+                         a.duracao() == b.duracao();
+                for (AtvId v = 0; iguais && v < grafo.tamanho(); ++v) {
+                    const auto x = a.atividade(v);
+                    const auto y = b.atividade(v);
+                    iguais = x.peso == y.peso && x.iniciada == y.iniciada &&
+                             x.finalizada == y.finalizada && x.earlyStart == y.earlyStart &&
+                             x.earlyFinish == y.earlyFinish && x.lateStart == y.lateStart &&
+                             x.lateFinish == y.lateFinish;
+                }
+
+                std::vector<AtvId> atrasadasA, atrasadasB;
+                reproducao.execucao().atrasadas(atrasadasA);
+                execucao.atrasadas(atrasadasB);
+                iguais = iguais && atrasadasA == atrasadasB;
+            }
+            if (!iguais) {
+                std::cerr << "ERRO: salto difere da reproducao desde o inicio\n";
+                return EXIT_FAILURE;
+            }
+        }
+
+        // Cálculo completo pela biblioteca (leitura, cronograma, dias e um
+        // caminho crítico) x um processo do caminho_mistico por cálculo
+        ProjetoCalculado calculado;
+        ErroProjeto erroCalculo;
+        bool calculou = true;
+        fases.push_back(Fase{"api", cronometra(repeticoes, [&]() {
+            for (size_t i = 0; i < QTDE_CHAMADAS; ++i) {
+                calculou = calculaProjeto(calculado, erroCalculo, arquivo) && calculou;
+            }
+        }), QTDE_CHAMADAS / 1e3, "kcalc/s"});
+
+        if (!calculou || calculado.duracaoCritica != cronograma.duracao ||
+            calculado.dias != projeto.dias.size()) {
+            std::cerr << "ERRO: calculo pela biblioteca difere das fases ("
+                      << descreveErro(erroCalculo) << ")\n";
+            return EXIT_FAILURE;
+        }
+
+#if defined(BENCHMARK_PROCESSO)
+        char temporario[] = "/tmp/benchmark_misticoXXXXXX";
+        const int descritor = mkstemp(temporario);
+        if (descritor < 0) {
+            std::cerr << "ERRO: nao se pode criar o arquivo temporario\n";
+            return EXIT_FAILURE;
+        }
+        close(descritor);
+        {
+            std::ofstream saida(temporario, std::ios::binary);
+            saida << arquivo;
+        }
+
+        bool executou = true;
+        fases.push_back(Fase{"processo", cronometra(repeticoes, [&]() {
+            for (size_t i = 0; i < QTDE_CHAMADAS; ++i) {
+                executou = executaProcesso(temporario) && executou;
+            }
+        }), QTDE_CHAMADAS / 1e3, "kcalc/s"});
+        std::remove(temporario);
+
+        if (!executou) {
+            std::cerr << "ERRO: falha ao executar " << CAMINHO_MISTICO_EXECUTAVEL << "\n";
+            return EXIT_FAILURE;
+        }
+#endif
+
+        const auto pico = picoMemoria();
+
+        for (const auto &f : fases) {
+            const double vazao = f.ms > 0 ? f.quantidade / (f.ms / 1e3) : 0;
+            std::cout << std::left << std::setw(12) << n
+                      << std::setw(11) << f.nome
+                      << std::right << std::fixed << std::setprecision(3)
+                      << std::setw(12) << f.ms
+                      << std::setw(16) << vazao
+                      << "  " << std::left << std::setw(12) << f.unidade
+                      << std::right << std::setw(13) << pico << "\n";
+        }
+
+        std::cout << std::left << std::setw(12) << n << std::setw(11) << "alocacoes"
+                  << alocacoesLeitura << " na leitura, " << alocacoesExecucao
+                  << " na execucao, " << alocacoesAlertas << " com alertas ("
+                  << projeto.dias.size() << " dias)\n";
+
+        if (qtdeCaminhos > LIMITE_CAMINHOS) {
+            std::cout << std::left << std::setw(12) << n << std::setw(11) << "caminhos"
+                      << "(omitido: mais de " << LIMITE_CAMINHOS << " caminhos)\n";
+        }
+        std::cout.flush();
+    }
+
+    return 0;
+}
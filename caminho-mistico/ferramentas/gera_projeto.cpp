@@ -0,0 +1,86 @@
+/// Calculador de Caminho Critico
+/// Gerador de projetos sintéticos (linha de comando)
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include <cstdlib>      // atoi, atof, strtoull
+#include <cstring>      // strcmp
+#include <fstream>      // ofstream
+#include <iostream>     // cout, cerr
+
+#include "gerador.h"    // geraProjeto, ParametrosGerador
+
+/// Verifica se o argumento é uma das opções
+/// @param arg argumento
+/// @param curta opção curta
+/// @param longa opção longa
+static bool opcao(const char *arg, const char *curta, const char *longa) {
+    return 0 == std::strcmp(arg, curta) || 0 == std::strcmp(arg, longa);
+}
+
+int main(int argc, const char *argv[]) {
+
+    // -n / --atividades N: quantidade de atividades (sem inicio/fim)
+    // -d / --densidade X: conexões extras por atividade (média)
+    // -f / --forma F: cadeia, leque, camadas ou serie-paralelo
+    // -l / --dias N: dias da terceira seção (0: até o fim da execução)
+    // -a / --atraso N: atraso máximo sorteado por início/término (dias)
+    // -s / --semente N: semente do sorteio
+    // -3 / --tres-pontos: estimativas {nome,otimista,provavel,pessimista}
+    // -o / --saida arquivo (padrão: stdout)
+    ParametrosGerador parametros;
+    const char *saida = nullptr;
+    bool argsValidos = true;
+
+    for (int i = 1; i < argc; ++i) {
+        const bool temValor = i + 1 < argc;
+
+        if (opcao(argv[i], "-n", "--atividades") && temValor) {
+            parametros.atividades = static_cast<uint32_t>(std::atoi(argv[++i]));
+        } else if (opcao(argv[i], "-d", "--densidade") && temValor) {
+            parametros.densidade = std::atof(argv[++i]);
+        } else if (opcao(argv[i], "-f", "--forma") && temValor) {
+            argsValidos = argsValidos && leForma(argv[++i], parametros.forma);
+        } else if (opcao(argv[i], "-l", "--dias") && temValor) {
+            parametros.dias = static_cast<uint32_t>(std::atoi(argv[++i]));
+        } else if (opcao(argv[i], "-a", "--atraso") && temValor) {
+            parametros.atrasoMaximo = std::atoi(argv[++i]);
+        } else if (opcao(argv[i], "-s", "--semente") && temValor) {
+            parametros.semente = std::strtoull(argv[++i], nullptr, 10);
+        } else if (opcao(argv[i], "-3", "--tres-pontos")) {
+            parametros.tresPontos = true;
+        } else if (opcao(argv[i], "-o", "--saida") && temValor) {
+            saida = argv[++i];
+        } else {
+            argsValidos = false;
+        }
+    }
+
+    if (!argsValidos) {
+        std::cerr << "ERRO: argumentos invalidos. Tente:\n"
+                  << "$ " << argv[0]
+                  << " [-n atividades] [-d densidade] [-f cadeia|leque|camadas|serie-paralelo]"
+                     " [-l dias] [-a atraso] [-s semente] [-3] [-o arquivo.txt]\n";
+        return EXIT_FAILURE;
+    }
+
+    if (nullptr == saida) {
+        std::ios::sync_with_stdio(false);
+        geraProjeto(std::cout, parametros);
+        std::cout.flush();
+        return 0;
+    }
+
+    std::ofstream arquivo(saida, std::ios::binary);
+
+    if (!arquivo.is_open()) {
+        std::cerr << "ERRO: nao se pode criar o arquivo " << saida << "\n";
+        return EXIT_FAILURE;
+    }
+
+    geraProjeto(arquivo, parametros);
+    return 0;
+}
@@ -0,0 +1,108 @@
+/// Calculador de Caminho Critico
+/// Projeto fixo: reprodução dos dias com o cronograma calculado na compilação
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include <cstdlib>      // EXIT_FAILURE
+#include <cstring>      // memchr
+#include <iostream>     // cout, cerr
+#include <string>       // string
+#include <vector>       // vector
+
+#include "arquivo.h"    // ArquivoMapeado
+#include "fixo.h"       // projetoFixo, AtividadeFixa, ConexaoFixa
+#include "parser.h"     // parseExecucao, localizaExecucao, Day
+
+namespace {
+
+// Projeto de exemplo.txt: o cabeçalho e as conexões fazem parte do programa
+constexpr AtividadeFixa ATIVIDADES[] = {
+        {"INICIO", -1}, {"ATV1", 2}, {"ATV2", 2}, {"ATV3", 4}, {"ATV4", 2}, {"FIM", -1}};
+
+constexpr ConexaoFixa CONEXOES[] = {
+        {"INICIO", "ATV1"}, {"ATV1", "ATV2"}, {"ATV1", "ATV3"},
+        {"ATV2", "ATV4"}, {"ATV3", "ATV4"}, {"ATV4", "FIM"}};
+
+constexpr auto PROJETO = projetoFixo(ATIVIDADES, CONEXOES);
+
+// Erros de cabeçalho e de conexões impedem a compilação
+static_assert(PROJETO.extremosValidos, "projeto fixo: exatamente dois extremos (peso -1)");
+static_assert(PROJETO.nomesUnicos, "projeto fixo: atividade repetida");
+static_assert(PROJETO.conexoesConhecidas, "projeto fixo: conexao com atividade inexistente");
+static_assert(PROJETO.conexoesUnicas, "projeto fixo: conexao repetida");
+static_assert(PROJETO.semCiclo, "projeto fixo: ciclo");
+static_assert(PROJETO.todasNoCaminho, "projeto fixo: atividade fora dos caminhos inicio -> fim");
+
+// Cronograma estático conferido na compilação (ver a saída de --lote exemplo.txt)
+static_assert(8 == PROJETO.duracao, "duracao");
+static_assert(3 == PROJETO.earlyStart[PROJETO.id("ATV2")] && 5 == PROJETO.lateStart[PROJETO.id("ATV2")],
+              "ATV2: ES 3, LS 5");
+static_assert(0 == PROJETO.slack[PROJETO.id("ATV3")] && 7 == PROJETO.lateFinish[PROJETO.id("ATV3")],
+              "ATV3: caminho critico");
+static_assert(PROJETO.id("ATV4") == PROJETO.ordem[4] && PROJETO.id("ATV1") == PROJETO.alfabetica[0],
+              "ordens");
+
+} // namespace
+
+int main(int argc, const char *argv[]) {
+
+    // Arquivo com a execução dos dias: um projeto completo (somente a
+    // terceira seção é lida) ou apenas as linhas "N: {i:A;f:B}"
+    if (2 != argc) {
+        std::cerr << "ERRO: argumentos invalidos. Tente:\n"
+                  << "$ " << argv[0] << " execucao.txt\n";
+        return EXIT_FAILURE;
+    }
+
+    ArquivoMapeado arquivo;
+    std::string erroArquivo;
+
+    if (!arquivo.abre(argv[1], erroArquivo)) {
+        std::cerr << "ERRO: " << erroArquivo << "\n";
+        return EXIT_FAILURE;
+    }
+
+    // Nenhuma leitura de cabeçalho nem cálculo: as tabelas são copiadas
+    Grafo grafo;
+    Cronograma cronograma;
+    PROJETO.monta(grafo, cronograma);
+
+    Execucao execucao;
+    PROJETO.inicializa(execucao, grafo, cronograma);
+
+    size_t inicio = 0;
+    int linhaAnterior = 0;
+    if (nullptr != std::memchr(arquivo.dados(), '#', arquivo.tamanho()) &&
+        !localizaExecucao(arquivo.dados(), arquivo.tamanho(), inicio, linhaAnterior)) {
+        std::cerr << "ERRO: o arquivo deve ter tres demarcadores '#' ou somente a execucao\n";
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Day> dias;
+    Arena memoria;
+    ErroParse erro;
+
+    if (!parseExecucao(dias, memoria, grafo, arquivo.dados() + inicio, arquivo.tamanho() - inicio,
+                       linhaAnterior, erro)) {
+        std::cerr << "ERRO: linha " << erro.linha << ", coluna " << erro.coluna << ": "
+                  << erro.mensagem << "\n";
+        return EXIT_FAILURE;
+    }
+
+    std::ios::sync_with_stdio(false);
+
+    for (const auto &d : dias) execucao.processaDia(d, &std::cout);
+
+    std::vector<AtvId> atrasadas;
+    execucao.atrasadas(atrasadas);
+
+    std::cout << "\nDuracao prevista: " << execucao.escalonador().duracao()
+              << " (estimada: " << PROJETO.duracao << ")\nAtrasadas:";
+    for (const auto v : atrasadas) std::cout << " " << grafo.nomes[v];
+    std::cout << "\n";
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+/// Calculador de Caminho Critico
+/// Alocador por blocos ("arena") para os registros da leitura
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "arena.h"
+
+#include <algorithm>    // max, min
+#include <cstdint>      // uintptr_t
+#include <iterator>     // make_move_iterator
+#include <utility>      // move
+
+namespace {
+
+/// Maior bloco obtido por crescimento (alocações maiores têm bloco próprio)
+const size_t BLOCO_MAXIMO = 1 << 20;
+
+} // namespace
+
+void *Arena::aloca(size_t bytes, size_t alinhamento) {
+
+    auto desalinho = [&]() {
+        const auto resto = reinterpret_cast<uintptr_t>(atual) & (alinhamento - 1);
+        return resto ? alinhamento - resto : 0;
+    };
+
+    if (nullptr == atual || desalinho() + bytes > livre) {
+        const auto tamanho = std::max(proximoBloco, bytes + alinhamento);
+        std::unique_ptr<char[]> bloco(new char[tamanho]);
+        atual = bloco.get();
+        blocos.push_back(std::move(bloco));
+        livre = tamanho;
+        reservados += tamanho;
+        proximoBloco = std::min(2 * proximoBloco, BLOCO_MAXIMO);
+    }
+
+    const auto ajuste = desalinho();
+    void *p = atual + ajuste;
+    atual += ajuste + bytes;
+    livre -= ajuste + bytes;
+    return p;
+}
+
+void Arena::libera() {
+    blocos.clear();
+    atual = nullptr;
+    livre = 0;
+    proximoBloco = 4096;
+    reservados = 0;
+}
+
+void Arena::reinicia() {
+    // Somente blocos absorvidos, sem bloco atual: nada a reaproveitar
+    if (nullptr == atual) {
+        libera();
+        return;
+    }
+
+    const auto tamanho = livre + static_cast<size_t>(atual - blocos.back().get());
+    std::unique_ptr<char[]> bloco(std::move(blocos.back()));
+    blocos.clear();
+    blocos.push_back(std::move(bloco));
+
+    atual = blocos.back().get();
+    livre = tamanho;
+    reservados = tamanho;
+}
+
+void Arena::absorve(Arena &outra) {
+    if (&outra == this) return;
+
+    // O bloco atual continua o último (ver reinicia)
+    const auto posicao = nullptr == atual ? blocos.end() : blocos.end() - 1;
+    blocos.insert(posicao, std::make_move_iterator(outra.blocos.begin()),
+                  std::make_move_iterator(outra.blocos.end()));
+    reservados += outra.reservados;
+
+    outra.blocos.clear();
+    outra.libera();
+}
@@ -0,0 +1,75 @@
+/// Calculador de Caminho Critico
+/// Alocador por blocos ("arena") para os registros da leitura
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_ARENA_H
+#define CAMINHO_MISTICO_ARENA_H
+
+#include <cstddef>      // size_t
+#include <cstring>      // memcpy
+#include <memory>       // unique_ptr
+#include <type_traits>  // is_trivially_copyable
+#include <vector>       // vector
+
+/// Alocador "bump": cada alocação somente avança um ponteiro no bloco
+/// atual; um novo bloco (com o dobro do tamanho, até um limite) é obtido
+/// quando o atual se esgota. Nada é liberado individualmente: todos os
+/// blocos são liberados de uma vez na destruição
+/// Os endereços não mudam quando a arena é movida
+class Arena {
+public:
+    Arena() = default;
+    Arena(Arena &&) = default;
+    Arena &operator=(Arena &&) = default;
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    /// Copia n elementos para a arena (somente tipos trivialmente copiáveis)
+    /// @param origem elementos
+    /// @param n quantidade
+    /// @return cópia na arena (nullptr caso n == 0)
+    template<typename T>
+    T *copia(const T *origem, size_t n) {
+        static_assert(std::is_trivially_copyable<T>::value, "arena: tipo nao trivial");
+        if (0 == n) return nullptr;
+        auto destino = static_cast<T *>(aloca(n * sizeof(T), alignof(T)));
+        std::memcpy(destino, origem, n * sizeof(T));
+        return destino;
+    }
+
+    /// Reserva bytes alinhados
+    /// @param bytes quantidade de bytes
+    /// @param alinhamento potência de 2
+    void *aloca(size_t bytes, size_t alinhamento);
+
+    /// Libera todos os blocos
+    void libera();
+
+    /// Descarta as alocações mantendo somente o bloco atual, reaproveitado
+    /// pelas próximas (os endereços anteriores deixam de ser válidos)
+    void reinicia();
+
+    /// Assume os blocos de outra arena, sem copiar (os endereços continuam
+    /// válidos; a outra fica vazia). O bloco atual não muda: os blocos
+    /// absorvidos ficam antes dele
+    /// @param outra arena de origem
+    void absorve(Arena &outra);
+
+    /// Bytes reservados em blocos
+    size_t capacidade() const { return reservados; }
+
+private:
+    /// O último bloco é o atual (quando atual != nullptr)
+    std::vector<std::unique_ptr<char[]>> blocos;
+    char *atual = nullptr;
+    size_t livre = 0;
+    size_t proximoBloco = 4096;
+    size_t reservados = 0;
+};
+
+#endif // CAMINHO_MISTICO_ARENA_H
@@ -0,0 +1,102 @@
+/// Calculador de Caminho Critico
+/// Arquivo de entrada mapeado em memória (somente leitura)
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "arquivo.h"
+
+#include <sys/stat.h>   // S_ISREG, stat
+
+#if defined (_WIN32)
+#  include <fstream>    // ifstream
+#  ifndef S_ISREG
+#    define S_ISREG(mode)  (((mode) & S_IFMT) == S_IFREG)
+#  endif
+#else
+#  include <fcntl.h>    // open
+#  include <sys/mman.h> // mmap, munmap
+#  include <unistd.h>   // close
+#endif
+
+ArquivoMapeado::~ArquivoMapeado() {
+    fecha();
+}
+
+bool ArquivoMapeado::abre(const std::string &filename, std::string &erro) {
+
+    fecha();
+
+    // Verifica se é um arquivo regular
+    struct stat st;
+
+    if (0 != stat(filename.c_str(), &st)) {
+        erro = "nao se pode abrir o arquivo";
+        return false;
+    }
+
+    if (!S_ISREG(st.st_mode)) {
+        erro = "este nao e um arquivo regular";
+        return false;
+    }
+
+    bytes = static_cast<size_t>(st.st_size);
+
+#if defined (_WIN32)
+    std::ifstream file(filename, std::ios::binary);
+
+    if (!file.is_open()) {
+        erro = "nao se pode abrir o arquivo";
+        return false;
+    }
+
+    buffer.resize(bytes);
+    file.read(buffer.data(), static_cast<std::streamsize>(bytes));
+    bytes = static_cast<size_t>(file.gcount());
+    inicio = buffer.data();
+#else
+    const int fd = open(filename.c_str(), O_RDONLY);
+
+    if (fd < 0) {
+        erro = "nao se pode abrir o arquivo";
+        return false;
+    }
+
+    if (0 == bytes) {
+        close(fd);
+        inicio = "";
+        return true;
+    }
+
+    void *p = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (MAP_FAILED == p) {
+        erro = "nao se pode mapear o arquivo";
+        bytes = 0;
+        return false;
+    }
+
+    // Leitura sequencial: permite leitura antecipada agressiva
+    madvise(p, bytes, MADV_SEQUENTIAL);
+
+    inicio = static_cast<const char *>(p);
+    mapeado = true;
+#endif
+
+    return true;
+}
+
+void ArquivoMapeado::fecha() {
+#if !defined (_WIN32)
+    if (mapeado) {
+        munmap(const_cast<char *>(inicio), bytes);
+    }
+#endif
+    mapeado = false;
+    inicio = nullptr;
+    bytes = 0;
+    buffer.clear();
+}
@@ -0,0 +1,45 @@
+/// Calculador de Caminho Critico
+/// Arquivo de entrada mapeado em memória (somente leitura)
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_ARQUIVO_H
+#define CAMINHO_MISTICO_ARQUIVO_H
+
+#include <cstddef>      // size_t
+#include <string>       // string
+#include <vector>       // vector
+
+/// Arquivo regular mapeado em memória (mmap)
+/// Em plataformas sem mmap o conteúdo é lido para um único buffer
+class ArquivoMapeado {
+public:
+    ArquivoMapeado() = default;
+    ~ArquivoMapeado();
+
+    ArquivoMapeado(const ArquivoMapeado &) = delete;
+    ArquivoMapeado &operator=(const ArquivoMapeado &) = delete;
+
+    /// Abre e mapeia o arquivo
+    /// @param filename caminho do arquivo
+    /// @param erro mensagem de erro (caso retorne false)
+    /// @return false caso não seja um arquivo regular ou não possa ser aberto
+    bool abre(const std::string &filename, std::string &erro);
+
+    /// Libera o mapeamento
+    void fecha();
+
+    const char *dados() const { return inicio; }
+    size_t tamanho() const { return bytes; }
+
+private:
+    const char *inicio = nullptr;
+    size_t bytes = 0;
+    bool mapeado = false;
+    std::vector<char> buffer;
+};
+
+#endif // CAMINHO_MISTICO_ARQUIVO_H
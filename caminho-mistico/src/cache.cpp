@@ -0,0 +1,254 @@
+/// Calculador de Caminho Critico
+/// Cache binário do projeto (cabeçalho, conexões e cronograma estático)
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "cache.h"
+
+#include <atomic>       // atomic
+#include <cstdio>       // rename, remove
+#include <cstring>      // memcpy, memcmp
+#include <fstream>      // ofstream
+#include <string>       // to_string
+#include <vector>       // vector
+
+#if defined (_WIN32)
+#  include <process.h>  // _getpid
+#else
+#  include <unistd.h>   // getpid
+#endif
+
+#include "arquivo.h"    // ArquivoMapeado
+
+namespace {
+
+const char MAGICA[4] = {'C', 'M', 'C', '1'};
+/// Ids de 16 bits (perfil compacto): outro formato, sem confusão com o padrão
+const uint32_t VERSAO = sizeof(AtvId) == sizeof(uint32_t) ? 2 : 0x10002;
+const uint32_t ORDEM_BYTES = 0x01020304;
+
+/// Temporários gravados por este processo (nome único entre as threads)
+std::atomic<unsigned> temporarios(0);
+
+/// Nome do temporário de uma gravação: processo + sequência, para que
+/// gravações simultâneas do mesmo cache (portfólio com o mesmo projeto
+/// duas vezes, ou dois processos) não escrevam no mesmo arquivo
+std::string nomeTemporario(const std::string &arquivo) {
+#if defined (_WIN32)
+    const auto processo = _getpid();
+#else
+    const auto processo = getpid();
+#endif
+    return arquivo + "." + std::to_string(processo) + "." + std::to_string(temporarios++) + ".tmp";
+}
+
+struct CabecalhoCache {
+    char magica[4];
+    uint32_t versao;
+    uint32_t ordemBytes;
+    uint32_t atividades;
+    uint64_t hash;
+    uint64_t arestas;
+    uint64_t bytesNomes;
+    uint32_t inicio;
+    uint32_t fim;
+    int32_t duracao;
+    uint32_t tresPontos;    // 1: estimativas de três pontos após o slack
+};
+
+/// Escreve um vetor inteiro
+template<typename T>
+void escreve(std::ofstream &out, const std::vector<T> &v) {
+    out.write(reinterpret_cast<const char *>(v.data()),
+              static_cast<std::streamsize>(v.size() * sizeof(T)));
+}
+
+/// Leitor sequencial sobre o arquivo mapeado (com verificação de limites)
+class Bloco {
+public:
+    Bloco(const char *dados, size_t tamanho) : p(dados), fim(dados + tamanho) {}
+
+    template<typename T>
+    bool le(std::vector<T> &v, uint64_t qtde) {
+        if (qtde > static_cast<uint64_t>(fim - p) / sizeof(T)) return false;
+        v.resize(static_cast<size_t>(qtde));
+        const auto bytes = static_cast<size_t>(qtde) * sizeof(T);
+        if (bytes) std::memcpy(v.data(), p, bytes);
+        p += bytes;
+        return true;
+    }
+
+    bool le(void *destino, size_t bytes) {
+        if (bytes > static_cast<size_t>(fim - p)) return false;
+        std::memcpy(destino, p, bytes);
+        p += bytes;
+        return true;
+    }
+
+    bool terminou() const { return p == fim; }
+
+private:
+    const char *p;
+    const char *fim;
+};
+
+/// CSR consistente: deslocamentos crescentes, vizinhos válidos
+bool csrValida(const std::vector<uint32_t> &inicio, const std::vector<AtvId> &vizinhos,
+               AtvId n) {
+    if (inicio.front() != 0 || inicio.back() != vizinhos.size()) return false;
+    for (AtvId v = 0; v < n; ++v) {
+        if (inicio[v] > inicio[v + 1]) return false;
+    }
+    for (const auto s : vizinhos) {
+        if (s >= n) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+std::string arquivoCache(const std::string &arquivo) {
+    if (arquivo.size() > 4 && 0 == arquivo.compare(arquivo.size() - 4, 4, ".txt")) {
+        return arquivo.substr(0, arquivo.size() - 4) + ".cmc";
+    }
+    return arquivo + ".cmc";
+}
+
+uint64_t hashSecoes(const char *dados, size_t tamanho) {
+    uint64_t h = 14695981039346656037ull;
+    for (size_t i = 0; i < tamanho; ++i) {
+        h ^= static_cast<unsigned char>(dados[i]);
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+bool gravaCache(const std::string &arquivo, uint64_t hash,
+                const Grafo &grafo, const Cronograma &cronograma) {
+
+    const auto n = grafo.tamanho();
+
+    std::vector<uint32_t> deslocamentos(n + 1, 0);
+    std::string nomes;
+    for (AtvId v = 0; v < n; ++v) {
+        nomes += grafo.nomes[v];
+        deslocamentos[v + 1] = static_cast<uint32_t>(nomes.size());
+    }
+
+    CabecalhoCache c;
+    std::memset(&c, 0, sizeof(c));
+    std::memcpy(c.magica, MAGICA, sizeof(MAGICA));
+    c.versao = VERSAO;
+    c.ordemBytes = ORDEM_BYTES;
+    c.atividades = n;
+    c.hash = hash;
+    c.arestas = grafo.qtdeArestas();
+    c.bytesNomes = nomes.size();
+    c.inicio = grafo.inicio;
+    c.fim = grafo.fim;
+    c.duracao = cronograma.duracao;
+    c.tresPontos = grafo.estimativa.empty() ? 0 : 1;
+
+    // Temporário + rename: um leitor nunca vê um cache pela metade
+    const auto temporario = nomeTemporario(arquivo);
+    {
+        std::ofstream out(temporario, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) return false;
+
+        out.write(reinterpret_cast<const char *>(&c), sizeof(c));
+        escreve(out, deslocamentos);
+        out.write(nomes.data(), static_cast<std::streamsize>(nomes.size()));
+        escreve(out, grafo.peso);
+        escreve(out, grafo.sucInicio);
+        escreve(out, grafo.sucessores);
+        escreve(out, grafo.antInicio);
+        escreve(out, grafo.antecessores);
+        escreve(out, cronograma.earlyStart);
+        escreve(out, cronograma.earlyFinish);
+        escreve(out, cronograma.lateStart);
+        escreve(out, cronograma.lateFinish);
+        escreve(out, cronograma.slack);
+        escreve(out, grafo.estimativa);
+
+        if (!out.good()) {
+            out.close();
+            std::remove(temporario.c_str());
+            return false;
+        }
+    }
+
+    std::remove(arquivo.c_str()); // rename não substitui no Windows
+    if (0 != std::rename(temporario.c_str(), arquivo.c_str())) {
+        std::remove(temporario.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool carregaCache(Grafo &grafo, Cronograma &cronograma,
+                  const std::string &arquivo, uint64_t hash) {
+
+    ArquivoMapeado mapa;
+    std::string erro;
+
+    if (!mapa.abre(arquivo, erro)) return false;
+
+    Bloco b(mapa.dados(), mapa.tamanho());
+
+    CabecalhoCache c;
+    if (!b.le(&c, sizeof(c)) ||
+        0 != std::memcmp(c.magica, MAGICA, sizeof(MAGICA)) ||
+        c.versao != VERSAO || c.ordemBytes != ORDEM_BYTES || c.hash != hash ||
+        c.atividades > MAX_ATIVIDADES) {
+        return false;
+    }
+
+    const AtvId n = c.atividades;
+
+    std::vector<uint32_t> deslocamentos;
+    std::vector<char> nomes;
+    Grafo g;
+
+    if (!b.le(deslocamentos, n + 1ull) || !b.le(nomes, c.bytesNomes) ||
+        !b.le(g.peso, n) ||
+        !b.le(g.sucInicio, n + 1ull) || !b.le(g.sucessores, c.arestas) ||
+        !b.le(g.antInicio, n + 1ull) || !b.le(g.antecessores, c.arestas)) {
+        return false;
+    }
+
+    Cronograma cr;
+    cr.inicializa(n);
+
+    if (!b.le(cr.earlyStart, n) || !b.le(cr.earlyFinish, n) ||
+        !b.le(cr.lateStart, n) || !b.le(cr.lateFinish, n) ||
+        !b.le(cr.slack, n) || !b.le(g.estimativa, c.tresPontos ? n : 0) ||
+        !b.terminou()) {
+        return false;
+    }
+
+    if (c.inicio >= n || c.fim >= n ||
+        !csrValida(g.sucInicio, g.sucessores, n) ||
+        !csrValida(g.antInicio, g.antecessores, n) ||
+        deslocamentos.front() != 0 || deslocamentos.back() != nomes.size()) {
+        return false;
+    }
+
+    g.nomes.reserve(n);
+    for (AtvId v = 0; v < n; ++v) {
+        if (deslocamentos[v] > deslocamentos[v + 1]) return false;
+        g.nomes.push_back(std::string(nomes.data() + deslocamentos[v],
+                                      deslocamentos[v + 1] - deslocamentos[v]));
+    }
+
+    g.inicio = c.inicio;
+    g.fim = c.fim;
+    g.indexa();
+    cr.duracao = c.duracao;
+
+    grafo = std::move(g);
+    cronograma = std::move(cr);
+    return true;
+}
@@ -0,0 +1,53 @@
+/// Calculador de Caminho Critico
+/// Cache binário do projeto (cabeçalho, conexões e cronograma estático)
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_CACHE_H
+#define CAMINHO_MISTICO_CACHE_H
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+#include <string>       // string
+
+#include "cpm.h"        // Cronograma
+#include "grafo.h"      // Grafo
+
+/// Formato (ordem de bytes nativa, verificada na leitura):
+///     cabeçalho fixo (CabecalhoCache)
+///     deslocamento de cada nome (n + 1) e bytes dos nomes
+///     peso (n), sucInicio (n + 1), sucessores (E), antInicio (n + 1),
+///     antecessores (E)
+///     ES, EF, LS, LF e slack estáticos (n cada)
+///     estimativas de três pontos (n, somente se houver)
+/// O cache só é aceito se o hash das duas primeiras seções do .txt for o
+/// mesmo gravado; a terceira seção é sempre lida do texto
+
+/// Caminho do cache de um arquivo: "projeto.txt" -> "projeto.cmc"
+std::string arquivoCache(const std::string &arquivo);
+
+/// Hash FNV-1a de 64 bits (cabeçalho + conexões do arquivo de texto)
+uint64_t hashSecoes(const char *dados, size_t tamanho);
+
+/// Grava o cache (arquivo temporário + rename)
+/// @param arquivo caminho do cache
+/// @param hash hash das duas primeiras seções
+/// @param grafo grafo validado
+/// @param cronograma cronograma estático (calculaCPM)
+/// @return false caso não seja possível gravar
+bool gravaCache(const std::string &arquivo, uint64_t hash,
+                const Grafo &grafo, const Cronograma &cronograma);
+
+/// Carrega o cache, caso exista e corresponda ao hash
+/// @param grafo grafo de saída
+/// @param cronograma cronograma estático de saída
+/// @param arquivo caminho do cache
+/// @param hash hash das duas primeiras seções do arquivo de texto
+/// @return false caso o cache não exista, esteja desatualizado ou corrompido
+bool carregaCache(Grafo &grafo, Cronograma &cronograma,
+                  const std::string &arquivo, uint64_t hash);
+
+#endif // CAMINHO_MISTICO_CACHE_H
@@ -0,0 +1,55 @@
+/// Calculador de Caminho Critico
+/// Calendário de marcos: chave (dia) -> atividades com o marco nesse dia
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "calendario.h"
+
+void Calendario::inicializa(AtvId n) {
+    // Um balde por atividade, no mínimo
+    size_t capacidade = 64;
+    uint32_t bits = 6;
+    while (capacidade < n) {
+        capacidade *= 2;
+        ++bits;
+    }
+
+    baldes.assign(capacidade, ATV_NULA);
+    deslocamento = 32 - bits;
+    proxima.assign(n, ATV_NULA);
+    anterior.assign(n, ATV_NULA);
+    chaves.assign(n, 0);
+    agendadas.assign(n, 0);
+}
+
+void Calendario::agenda(AtvId v, int chave) {
+    if (agendadas[v]) {
+        if (chaves[v] == chave) return;
+        remove(v);
+    }
+
+    // Insere no início do balde
+    auto &primeira = baldes[balde(chave)];
+    chaves[v] = chave;
+    anterior[v] = ATV_NULA;
+    proxima[v] = primeira;
+    if (ATV_NULA != primeira) anterior[primeira] = v;
+    primeira = v;
+    agendadas[v] = 1;
+}
+
+void Calendario::remove(AtvId v) {
+    if (!agendadas[v]) return;
+
+    if (ATV_NULA != anterior[v]) {
+        proxima[anterior[v]] = proxima[v];
+    } else {
+        baldes[balde(chaves[v])] = proxima[v];
+    }
+    if (ATV_NULA != proxima[v]) anterior[proxima[v]] = anterior[v];
+
+    agendadas[v] = 0;
+}
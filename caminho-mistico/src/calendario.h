@@ -0,0 +1,65 @@
+/// Calculador de Caminho Critico
+/// Calendário de marcos: chave (dia) -> atividades com o marco nesse dia
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_CALENDARIO_H
+#define CAMINHO_MISTICO_CALENDARIO_H
+
+#include <cstdint>      // uint32_t
+#include <vector>       // vector
+
+#include "grafo.h"      // AtvId, ATV_NULA
+
+/// Índice de um marco (ES, EF, LS ou LF) por chave
+///
+/// Cada atividade está em no máximo uma chave: quando a data muda, a
+/// atividade é movida (remoção O(1) de uma lista duplamente encadeada pelos
+/// próprios ids). As listas ficam em uma tabela de baldes com capacidade
+/// fixa (potência de 2 >= n), indexada pelos bits altos do produto da chave
+/// pela razão áurea (hash de Fibonacci): chaves quaisquer (dias anômalos no
+/// arquivo) e nenhuma alocação depois de inicializa. Chaves em progressão
+/// (marcos semanais, dias além da capacidade) caem em baldes distintos, em
+/// vez de se acumularem em um balde como no módulo da capacidade. A consulta
+/// de um dia visita somente o seu balde: lacunas na numeração dos dias não
+/// custam nada
+class Calendario {
+public:
+    /// Esvazia o calendário
+    /// @param n quantidade de atividades (ids 0..n-1)
+    void inicializa(AtvId n);
+
+    /// Agenda (ou move) uma atividade para uma chave
+    void agenda(AtvId v, int chave);
+
+    /// Remove uma atividade (caso esteja agendada)
+    void remove(AtvId v);
+
+    /// Visita as atividades agendadas em uma chave (em qualquer ordem)
+    /// @param chave chave
+    /// @param f função chamada com cada atividade (AtvId)
+    template<typename F>
+    void percorre(int chave, F f) const {
+        if (baldes.empty()) return;
+        for (auto v = baldes[balde(chave)]; ATV_NULA != v; v = proxima[v]) {
+            if (chaves[v] == chave) f(v);
+        }
+    }
+
+private:
+    uint32_t balde(int chave) const {
+        return (static_cast<uint32_t>(chave) * 2654435769u) >> deslocamento;
+    }
+
+    std::vector<AtvId> baldes;          // primeira atividade (ATV_NULA: vazio)
+    std::vector<AtvId> proxima;
+    std::vector<AtvId> anterior;
+    std::vector<int> chaves;            // chave de cada atividade
+    std::vector<char> agendadas;
+    uint32_t deslocamento = 31;         // 32 - log2(capacidade)
+};
+
+#endif // CAMINHO_MISTICO_CALENDARIO_H
@@ -0,0 +1,291 @@
+/// Calculador de Caminho Critico
+/// Lote de cenários: várias durações para a mesma topologia (SIMD)
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "cenarios.h"
+
+#include <algorithm>    // max
+#include <atomic>       // atomic
+#include <cstring>      // strcmp
+
+#include "cpm.h"        // ordenaTopologica, marcaCaminhos
+
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+#  define CENARIOS_X86 1
+#  include <immintrin.h> // AVX2, SSE4.1
+#endif
+
+namespace {
+
+/// Operações sobre linhas de n inteiros (um elemento por cenário)
+struct Kernels {
+    void (*preenche)(int32_t *dst, int32_t valor, size_t n);
+    void (*maximo)(int32_t *dst, const int32_t *src, size_t n);       // dst = max(dst, src)
+    void (*soma)(int32_t *dst, const int32_t *a, const int32_t *b, size_t n);
+    void (*subtrai)(int32_t *dst, const int32_t *a, const int32_t *b, size_t n);
+    const char *nome;
+};
+
+// Escalar (também o final das linhas nas versões vetoriais)
+
+void preencheEscalar(int32_t *dst, int32_t valor, size_t n) {
+    for (size_t i = 0; i < n; ++i) dst[i] = valor;
+}
+
+void maximoEscalar(int32_t *dst, const int32_t *src, size_t n) {
+    for (size_t i = 0; i < n; ++i) dst[i] = std::max(dst[i], src[i]);
+}
+
+void somaEscalar(int32_t *dst, const int32_t *a, const int32_t *b, size_t n) {
+    for (size_t i = 0; i < n; ++i) dst[i] = a[i] + b[i];
+}
+
+void subtraiEscalar(int32_t *dst, const int32_t *a, const int32_t *b, size_t n) {
+    for (size_t i = 0; i < n; ++i) dst[i] = a[i] - b[i];
+}
+
+#if defined (CENARIOS_X86)
+
+// AVX2: 8 cenários por instrução
+
+__attribute__((target("avx2")))
+void preencheAvx2(int32_t *dst, int32_t valor, size_t n) {
+    const __m256i v = _mm256_set1_epi32(valor);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), v);
+    preencheEscalar(dst + i, valor, n - i);
+}
+
+__attribute__((target("avx2")))
+void maximoAvx2(int32_t *dst, const int32_t *src, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const auto d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+        const auto s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_max_epi32(d, s));
+    }
+    maximoEscalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx2")))
+void somaAvx2(int32_t *dst, const int32_t *a, const int32_t *b, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+        const auto y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_add_epi32(x, y));
+    }
+    somaEscalar(dst + i, a + i, b + i, n - i);
+}
+
+__attribute__((target("avx2")))
+void subtraiAvx2(int32_t *dst, const int32_t *a, const int32_t *b, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+        const auto y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_sub_epi32(x, y));
+    }
+    subtraiEscalar(dst + i, a + i, b + i, n - i);
+}
+
+// SSE4.1: 4 cenários por instrução (pmaxsd)
+
+__attribute__((target("sse4.1")))
+void preencheSse41(int32_t *dst, int32_t valor, size_t n) {
+    const __m128i v = _mm_set1_epi32(valor);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), v);
+    preencheEscalar(dst + i, valor, n - i);
+}
+
+__attribute__((target("sse4.1")))
+void maximoSse41(int32_t *dst, const int32_t *src, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const auto d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+        const auto s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_max_epi32(d, s));
+    }
+    maximoEscalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("sse4.1")))
+void somaSse41(int32_t *dst, const int32_t *a, const int32_t *b, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+        const auto y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_add_epi32(x, y));
+    }
+    somaEscalar(dst + i, a + i, b + i, n - i);
+}
+
+__attribute__((target("sse4.1")))
+void subtraiSse41(int32_t *dst, const int32_t *a, const int32_t *b, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+        const auto y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_sub_epi32(x, y));
+    }
+    subtraiEscalar(dst + i, a + i, b + i, n - i);
+}
+
+#endif // CENARIOS_X86
+
+/// Operações suportadas pelo processador, da preferida à escalar (detecção
+/// uma única vez)
+const std::vector<Kernels> &disponiveis() {
+    static const std::vector<Kernels> lista = []() {
+        std::vector<Kernels> suportados;
+#if defined (CENARIOS_X86)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            suportados.push_back(Kernels{preencheAvx2, maximoAvx2, somaAvx2, subtraiAvx2, "avx2"});
+        }
+        if (__builtin_cpu_supports("sse4.1")) {
+            suportados.push_back(Kernels{preencheSse41, maximoSse41, somaSse41, subtraiSse41,
+                                         "sse4.1"});
+        }
+#endif
+        suportados.push_back(Kernels{preencheEscalar, maximoEscalar, somaEscalar, subtraiEscalar,
+                                     "escalar"});
+        return suportados;
+    }();
+    return lista;
+}
+
+/// Operações escolhidas por usaInstrucoesCenarios (nullptr: a preferida)
+std::atomic<const Kernels *> escolhidos(nullptr);
+
+const Kernels &kernels() {
+    const auto k = escolhidos.load(std::memory_order_acquire);
+    return nullptr != k ? *k : disponiveis().front();
+}
+
+} // namespace
+
+void LoteCenarios::inicializa(const Grafo &grafo, size_t qtde) {
+    cenarios = qtde;
+    duracao.resize(static_cast<size_t>(grafo.tamanho()) * qtde);
+    for (AtvId v = 0; v < grafo.tamanho(); ++v) {
+        std::fill(duracao.begin() + v * qtde, duracao.begin() + (v + 1) * qtde, grafo.peso[v]);
+    }
+}
+
+const char *instrucoesCenarios() {
+    return kernels().nome;
+}
+
+std::vector<const char *> instrucoesDisponiveis() {
+    std::vector<const char *> nomes;
+    for (const auto &k : disponiveis()) nomes.push_back(k.nome);
+    return nomes;
+}
+
+bool usaInstrucoesCenarios(const char *nome) {
+    for (const auto &k : disponiveis()) {
+        if (0 == std::strcmp(k.nome, nome)) {
+            escolhidos.store(&k, std::memory_order_release);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool calculaCenarios(ResultadoCenarios &resultado, const Grafo &grafo,
+                     const LoteCenarios &lote) {
+
+    const auto n = grafo.tamanho();
+    const auto S = lote.cenarios;
+    const auto &k = kernels();
+
+    if (lote.duracao.size() != static_cast<size_t>(n) * S) {
+        return false;
+    }
+
+    resultado.cenarios = S;
+    resultado.duracaoProjeto.assign(S, 0);
+    resultado.earlyFinish.assign(static_cast<size_t>(n) * S, 0);
+    resultado.lateFinish.assign(static_cast<size_t>(n) * S, 0);
+    resultado.slack.assign(static_cast<size_t>(n) * S, 0);
+
+    std::vector<AtvId> ordem;
+    if (!ordenaTopologica(ordem, grafo)) {
+        return false; // ciclo
+    }
+
+    if (grafo.inicio == ATV_NULA || grafo.fim == ATV_NULA || 0 == S) {
+        return true;
+    }
+
+    std::vector<char> noCaminho;
+    marcaCaminhos(noCaminho, grafo, ordem);
+
+    auto linha = [S](std::vector<int32_t> &m, AtvId v) { return m.data() + v * S; };
+
+    // Peso efetivo: extremos e durações negativas não contam
+    std::vector<int32_t> w(lote.duracao);
+    for (AtvId v = 0; v < n; ++v) {
+        auto p = linha(w, v);
+        if (v == grafo.inicio || v == grafo.fim) {
+            k.preenche(p, 0, S);
+        } else {
+            for (size_t c = 0; c < S; ++c) p[c] = std::max(p[c], 0);
+        }
+    }
+
+    std::vector<int32_t> es(static_cast<size_t>(n) * S, 0);
+    auto &ef = resultado.earlyFinish;
+    auto &lf = resultado.lateFinish;
+
+    // Passagem de ida: ES = max(1, EF das antecessoras); EF = ES + peso
+    for (const auto v : ordem) {
+        if (!noCaminho[v]) continue;
+
+        auto esV = linha(es, v);
+        k.preenche(esV, 1, S);
+
+        if (v != grafo.inicio) {
+            for (auto a = grafo.antBegin(v); a != grafo.antEnd(v); ++a) {
+                if (noCaminho[*a] && *a != grafo.fim) k.maximo(esV, linha(ef, *a), S);
+            }
+        }
+        k.soma(linha(ef, v), esV, linha(w, v), S);
+    }
+
+    // Duração + 1 de cada cenário: ES do fim
+    const auto fimMais1 = linha(es, grafo.fim);
+    for (size_t c = 0; c < S; ++c) resultado.duracaoProjeto[c] = fimMais1[c] - 1;
+
+    // Passagem de volta: cauda = peso + maior cauda das sucessoras;
+    // LS = (duração + 1) - cauda, LF = LS + peso, slack = LS - ES
+    std::vector<int32_t> cauda(static_cast<size_t>(n) * S, 0);
+    std::vector<int32_t> ls(S);
+
+    for (auto it = ordem.rbegin(); it != ordem.rend(); ++it) {
+        const auto v = *it;
+        if (!noCaminho[v]) continue;
+
+        auto caudaV = linha(cauda, v);
+        k.preenche(caudaV, 0, S);
+
+        if (v != grafo.fim) {
+            for (auto s = grafo.sucBegin(v); s != grafo.sucEnd(v); ++s) {
+                if (noCaminho[*s]) k.maximo(caudaV, linha(cauda, *s), S);
+            }
+        }
+        k.soma(caudaV, caudaV, linha(w, v), S);
+
+        k.subtrai(ls.data(), fimMais1, caudaV, S);
+        k.soma(linha(lf, v), ls.data(), linha(w, v), S);
+        k.subtrai(linha(resultado.slack, v), ls.data(), linha(es, v), S);
+    }
+
+    return true;
+}
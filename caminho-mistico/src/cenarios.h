@@ -0,0 +1,74 @@
+/// Calculador de Caminho Critico
+/// Lote de cenários: várias durações para a mesma topologia (SIMD)
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_CENARIOS_H
+#define CAMINHO_MISTICO_CENARIOS_H
+
+#include <cstddef>      // size_t
+#include <cstdint>      // int32_t
+#include <vector>       // vector
+
+#include "grafo.h"      // Grafo, AtvId
+
+/// Matriz de durações: uma linha por atividade, uma coluna por cenário
+/// (duracao[v * cenarios + c]); as colunas de uma atividade ficam
+/// contíguas, de forma que cada operação da passagem processa vários
+/// cenários por instrução
+/// A duração dos extremos (inicio/fim) é ignorada
+struct LoteCenarios {
+    size_t cenarios = 0;
+    std::vector<int32_t> duracao;
+
+    /// Lote com as durações do cabeçalho repetidas em todos os cenários
+    /// @param grafo grafo de dependências
+    /// @param cenarios quantidade de cenários
+    void inicializa(const Grafo &grafo, size_t cenarios);
+
+    int32_t &em(AtvId v, size_t c) { return duracao[v * cenarios + c]; }
+};
+
+/// Resultado por cenário (mesmo leiaute das durações)
+/// Atividades fora de qualquer caminho inicio -> fim ficam com zero
+struct ResultadoCenarios {
+    size_t cenarios = 0;
+    /// Duração do projeto em cada cenário
+    std::vector<int32_t> duracaoProjeto;
+    std::vector<int32_t> earlyFinish;
+    std::vector<int32_t> lateFinish;
+    std::vector<int32_t> slack;
+
+    int32_t ef(AtvId v, size_t c) const { return earlyFinish[v * cenarios + c]; }
+    int32_t lf(AtvId v, size_t c) const { return lateFinish[v * cenarios + c]; }
+    int32_t folga(AtvId v, size_t c) const { return slack[v * cenarios + c]; }
+};
+
+/// Calcula EF, LF, slack e a duração do projeto de todos os cenários em
+/// uma única passagem de ida e uma de volta em ordem topológica
+/// Mesmas regras de calculaCPM; as operações sobre as linhas (máximo,
+/// soma, subtração) usam AVX2 ou SSE4.1 quando o processador suporta
+/// (detecção em tempo de execução) e código escalar caso contrário
+/// @param resultado resultado de cada cenário
+/// @param grafo grafo de dependências
+/// @param lote matriz de durações
+/// @return false caso o grafo contenha um ciclo ou o lote tenha tamanho inválido
+bool calculaCenarios(ResultadoCenarios &resultado, const Grafo &grafo,
+                     const LoteCenarios &lote);
+
+/// Conjunto de instruções em uso pelos cenários ("avx2", "sse4.1" ou "escalar")
+const char *instrucoesCenarios();
+
+/// Conjuntos de instruções suportados pelo processador, do preferido ao "escalar"
+std::vector<const char *> instrucoesDisponiveis();
+
+/// Passa a usar um conjunto de instruções (testes e benchmark: vale para
+/// todas as chamadas seguintes, em qualquer thread)
+/// @param nome um dos nomes de instrucoesDisponiveis
+/// @return false caso o conjunto não seja suportado (nada muda)
+bool usaInstrucoesCenarios(const char *nome);
+
+#endif // CAMINHO_MISTICO_CENARIOS_H
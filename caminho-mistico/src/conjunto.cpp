@@ -0,0 +1,46 @@
+/// Calculador de Caminho Critico
+/// Conjunto ordenado de posições em bits (sem alocação após inicializa)
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "conjunto.h"
+
+void ConjuntoBits::inicializa(size_t n) {
+    const auto qtdePalavras = (n + 63) / 64;
+    palavras.assign(qtdePalavras, 0);
+    resumo.assign((qtdePalavras + 63) / 64, 0);
+    qtde = 0;
+}
+
+void ConjuntoBits::insere(uint32_t p) {
+    auto &palavra = palavras[p >> 6];
+    const auto bit = uint64_t(1) << (p & 63);
+    if (palavra & bit) return;
+
+    palavra |= bit;
+    resumo[p >> 12] |= uint64_t(1) << ((p >> 6) & 63);
+    ++qtde;
+}
+
+void ConjuntoBits::remove(uint32_t p) {
+    auto &palavra = palavras[p >> 6];
+    const auto bit = uint64_t(1) << (p & 63);
+    if (0 == (palavra & bit)) return;
+
+    palavra &= ~bit;
+    if (0 == palavra) resumo[p >> 12] &= ~(uint64_t(1) << ((p >> 6) & 63));
+    --qtde;
+}
+
+void ConjuntoBits::limpa() {
+    for (size_t r = 0; r < resumo.size(); ++r) {
+        for (auto bitsResumo = resumo[r]; 0 != bitsResumo; bitsResumo &= bitsResumo - 1) {
+            palavras[(r << 6) + menorBit(bitsResumo)] = 0;
+        }
+        resumo[r] = 0;
+    }
+    qtde = 0;
+}
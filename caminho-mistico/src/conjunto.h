@@ -0,0 +1,71 @@
+/// Calculador de Caminho Critico
+/// Conjunto ordenado de posições em bits (sem alocação após inicializa)
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_CONJUNTO_H
+#define CAMINHO_MISTICO_CONJUNTO_H
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t, uint64_t
+#include <vector>       // vector
+
+/// Índice do bit menos significativo (x != 0)
+inline unsigned menorBit(uint64_t x) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(x));
+#else
+    unsigned i = 0;
+    while (0 == (x & 1)) {
+        x >>= 1;
+        ++i;
+    }
+    return i;
+#endif
+}
+
+/// Conjunto de posições 0..n-1 em dois níveis de bits
+///
+/// Um bit por posição e um bit de resumo por palavra não vazia: inserção e
+/// remoção em O(1), percurso em ordem crescente em O(k + n/4096), sem os
+/// nós de um std::set (n/8 bytes, reservados em inicializa)
+class ConjuntoBits {
+public:
+    /// Esvazia o conjunto
+    /// @param n quantidade de posições
+    void inicializa(size_t n);
+
+    void insere(uint32_t p);
+    void remove(uint32_t p);
+
+    bool contem(uint32_t p) const { return 0 != (palavras[p >> 6] & (uint64_t(1) << (p & 63))); }
+    bool vazio() const { return 0 == qtde; }
+    size_t tamanho() const { return qtde; }
+
+    /// Esvazia em O(palavras não vazias)
+    void limpa();
+
+    /// Visita as posições em ordem crescente
+    /// @param f função chamada com cada posição (uint32_t)
+    template<typename F>
+    void percorre(F f) const {
+        for (size_t r = 0; r < resumo.size(); ++r) {
+            for (auto bitsResumo = resumo[r]; 0 != bitsResumo; bitsResumo &= bitsResumo - 1) {
+                const auto w = (r << 6) + menorBit(bitsResumo);
+                for (auto bits = palavras[w]; 0 != bits; bits &= bits - 1) {
+                    f(static_cast<uint32_t>((w << 6) + menorBit(bits)));
+                }
+            }
+        }
+    }
+
+private:
+    std::vector<uint64_t> palavras;
+    std::vector<uint64_t> resumo;   // bit w: palavras[w] != 0
+    size_t qtde = 0;
+};
+
+#endif // CAMINHO_MISTICO_CONJUNTO_H
@@ -0,0 +1,490 @@
+/// Calculador de Caminho Critico
+/// Motor de cálculo (CPM): passagens de ida e volta sobre o grafo
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "cpm.h"
+
+#include <algorithm>    // max, push_heap, pop_heap, stable_sort
+#include <functional>   // greater
+
+void Cronograma::inicializa(AtvId n) {
+    earlyStart.assign(n, 0);
+    earlyFinish.assign(n, 0);
+    lateStart.assign(n, 0);
+    lateFinish.assign(n, 0);
+    slack.assign(n, 0);
+    iniciada.assign(n, 0);
+    finalizada.assign(n, 0);
+    duracao = 0;
+}
+
+Estatisticas Cronograma::atividade(const Grafo &grafo, AtvId v) const {
+    Estatisticas e;
+    e.peso = grafo.peso[v];
+    e.iniciada = iniciada[v];
+    e.finalizada = finalizada[v];
+    e.earlyStart = earlyStart[v];
+    e.earlyFinish = earlyFinish[v];
+    e.lateStart = lateStart[v];
+    e.lateFinish = lateFinish[v];
+    e.slack = slack[v];
+    return e;
+}
+
+bool ordenaTopologica(std::vector<AtvId> &ordem, const Grafo &grafo) {
+
+    const auto n = grafo.tamanho();
+
+    std::vector<uint32_t> grau(n, 0);
+    ordem.clear();
+    ordem.reserve(n);
+
+    for (AtvId v = 0; v < n; ++v) {
+        grau[v] = grafo.antInicio[v + 1] - grafo.antInicio[v];
+        if (0 == grau[v]) ordem.push_back(v);
+    }
+
+    for (size_t i = 0; i < ordem.size(); ++i) {
+        for (auto s = grafo.sucBegin(ordem[i]); s != grafo.sucEnd(ordem[i]); ++s) {
+            if (0 == --grau[*s]) ordem.push_back(*s);
+        }
+    }
+
+    return ordem.size() == n; // caso contrário: ciclo
+}
+
+void marcaCaminhos(std::vector<char> &noCaminho, const Grafo &grafo,
+                   const std::vector<AtvId> &ordem) {
+
+    const auto n = grafo.tamanho();
+
+    noCaminho.assign(n, 0);
+
+    if (grafo.inicio == ATV_NULA || grafo.fim == ATV_NULA) return;
+
+    std::vector<char> alcancavel(n, 0);  // a partir do inicio
+    std::vector<char> chegaAoFim(n, 0);  // ate o fim
+
+    alcancavel[grafo.inicio] = 1;
+    for (const auto v : ordem) {
+        if (!alcancavel[v] || v == grafo.fim) continue;
+        for (auto s = grafo.sucBegin(v); s != grafo.sucEnd(v); ++s) alcancavel[*s] = 1;
+    }
+
+    chegaAoFim[grafo.fim] = 1;
+    for (auto it = ordem.rbegin(); it != ordem.rend(); ++it) {
+        if (*it == grafo.fim) continue;
+        for (auto s = grafo.sucBegin(*it); s != grafo.sucEnd(*it); ++s) {
+            if (chegaAoFim[*s]) {
+                chegaAoFim[*it] = 1;
+                break;
+            }
+        }
+    }
+
+    for (AtvId v = 0; v < n; ++v) {
+        noCaminho[v] = alcancavel[v] && chegaAoFim[v];
+    }
+}
+
+bool calculaCPM(Cronograma &cronograma, const Grafo &grafo) {
+
+    const auto n = grafo.tamanho();
+
+    cronograma.inicializa(n);
+
+    std::vector<AtvId> ordem;
+
+    if (!ordenaTopologica(ordem, grafo)) {
+        return false; // ciclo
+    }
+
+    if (grafo.inicio == ATV_NULA || grafo.fim == ATV_NULA) {
+        return true;
+    }
+
+    // Peso efetivo: extremos (-1) não contam
+    auto w = [&grafo](AtvId v) { return grafo.peso[v] > 0 ? grafo.peso[v] : 0; };
+
+    // Apenas as atividades em algum caminho inicio -> fim são consideradas
+    std::vector<char> marcados;
+    marcaCaminhos(marcados, grafo, ordem);
+
+    auto noCaminho = [&marcados](AtvId v) { return 0 != marcados[v]; };
+
+    auto &es = cronograma.earlyStart;
+    auto &ef = cronograma.earlyFinish;
+    auto &ls = cronograma.lateStart;
+    auto &lf = cronograma.lateFinish;
+
+    // Passagem de ida: ES = maior EF das antecessoras (1: primeiro dia)
+    for (const auto v : ordem) {
+        if (!noCaminho(v)) continue;
+
+        int maior = 1;
+        if (v != grafo.inicio) {
+            for (auto a = grafo.antBegin(v); a != grafo.antEnd(v); ++a) {
+                if (noCaminho(*a) && *a != grafo.fim) {
+                    maior = std::max(maior, ef[*a]);
+                }
+            }
+        }
+
+        es[v] = maior;
+        ef[v] = maior + w(v);
+    }
+
+    const auto duracao = es[grafo.fim] - 1;
+    cronograma.duracao = duracao;
+
+    // Passagem de volta: "cauda" = maior peso da atividade até o fim
+    std::vector<int> cauda(n, 0);
+
+    for (auto it = ordem.rbegin(); it != ordem.rend(); ++it) {
+        const auto v = *it;
+        if (!noCaminho(v)) continue;
+
+        int maior = 0;
+        if (v != grafo.fim) {
+            for (auto s = grafo.sucBegin(v); s != grafo.sucEnd(v); ++s) {
+                if (noCaminho(*s)) maior = std::max(maior, cauda[*s]);
+            }
+        }
+        cauda[v] = w(v) + maior;
+
+        // LS = duração - cauda + 1 (1: primeiro dia); LF = LS + Peso
+        ls[v] = duracao + 1 - cauda[v];
+        lf[v] = ls[v] + w(v);
+        // SL = LS - ES
+        cronograma.slack[v] = ls[v] - es[v];
+    }
+
+    return true;
+}
+
+Caminhos::Caminhos(const Grafo &g) : grafo(g) {
+
+    const auto n = g.tamanho();
+
+    menor.assign(n, 0);
+    maior.assign(n, 0);
+
+    std::vector<AtvId> ordem;
+    if (g.inicio == ATV_NULA || g.fim == ATV_NULA || !ordenaTopologica(ordem, g)) {
+        return;
+    }
+
+    // Volta: atividades até o fim pelo caminho mais curto e pelo mais longo
+    // (a busca não passa do fim)
+    menor[g.fim] = maior[g.fim] = 1;
+    for (auto it = ordem.rbegin(); it != ordem.rend(); ++it) {
+        const auto v = *it;
+        if (v == g.fim) continue;
+        for (auto s = g.sucBegin(v); s != g.sucEnd(v); ++s) {
+            if (0 == menor[*s]) continue;
+            if (0 == menor[v] || menor[*s] + 1 < menor[v]) menor[v] = menor[*s] + 1;
+            if (maior[*s] + 1 > maior[v]) maior[v] = maior[*s] + 1;
+        }
+    }
+}
+
+bool Caminhos::proximo(std::vector<AtvId> &caminho) {
+
+    if (grafo.inicio == ATV_NULA || 0 == menor[grafo.inicio]) return false;
+
+    if (!iniciado) {
+        iniciado = true;
+        comprimento = menor[grafo.inicio];
+        pilha.push_back(std::make_pair(grafo.inicio, grafo.sucBegin(grafo.inicio)));
+    } else if (!pilha.empty()) {
+        pilha.pop_back(); // fim: caminho entregue na chamada anterior
+    }
+
+    for (;;) {
+        if (pilha.empty()) {
+            // Busca do comprimento atual esgotada: próximo comprimento
+            if (comprimento >= maior[grafo.inicio]) return false;
+            ++comprimento;
+            pilha.push_back(std::make_pair(grafo.inicio, grafo.sucBegin(grafo.inicio)));
+        }
+
+        auto &topo = pilha.back();
+
+        if (topo.first == grafo.fim) {
+            caminho.clear();
+            for (const auto &p : pilha) caminho.push_back(p.first);
+            return true;
+        }
+
+        // Próximo sucessor que ainda pode completar o comprimento atual
+        const auto restante = comprimento - static_cast<uint32_t>(pilha.size());
+        const auto fimSuc = grafo.sucEnd(topo.first);
+        while (topo.second != fimSuc &&
+               !(0 != menor[*topo.second] && menor[*topo.second] <= restante &&
+                 restante <= maior[*topo.second])) {
+            ++topo.second;
+        }
+
+        if (topo.second == fimSuc) {
+            pilha.pop_back();
+            continue;
+        }
+
+        const auto prox = *topo.second++;
+        pilha.push_back(std::make_pair(prox, grafo.sucBegin(prox)));
+    }
+}
+
+CaminhosCriticos::CaminhosCriticos(const Grafo &g, const Cronograma &c)
+        : grafo(g), cronograma(c) {
+
+    const auto n = g.tamanho();
+
+    critica.assign(n, 0);
+
+    std::vector<AtvId> ordem;
+    if (g.inicio == ATV_NULA || g.fim == ATV_NULA ||
+        c.earlyStart.size() != n || !ordenaTopologica(ordem, g)) {
+        return;
+    }
+
+    // Ida: alcançáveis a partir do inicio somente por conexões justas,
+    // contando os caminhos (soma saturada)
+    std::vector<uint64_t> contagem(n, 0);
+    contagem[g.inicio] = 1;
+
+    for (const auto v : ordem) {
+        if (0 == contagem[v] || v == g.fim) continue;
+        for (auto s = g.sucBegin(v); s != g.sucEnd(v); ++s) {
+            if (!justa(v, *s)) continue;
+            contagem[*s] = (contagem[*s] > UINT64_MAX - contagem[v])
+                           ? UINT64_MAX : contagem[*s] + contagem[v];
+        }
+    }
+
+    qtde = contagem[g.fim];
+    saturou = (UINT64_MAX == qtde);
+
+    // Volta: das alcançáveis, as que chegam ao fim por conexões justas
+    // (a busca nunca entra em um ramo sem saída)
+    critica[g.fim] = (0 != qtde);
+    for (auto it = ordem.rbegin(); it != ordem.rend(); ++it) {
+        const auto v = *it;
+        if (0 == contagem[v] || v == g.fim) continue;
+        for (auto s = g.sucBegin(v); s != g.sucEnd(v); ++s) {
+            if (critica[*s] && justa(v, *s)) {
+                critica[v] = 1;
+                break;
+            }
+        }
+    }
+}
+
+bool CaminhosCriticos::justa(AtvId de, AtvId para) const {
+    return cronograma.earlyFinish[de] == cronograma.earlyStart[para];
+}
+
+bool CaminhosCriticos::proximo(std::vector<AtvId> &caminho) {
+
+    if (!iniciado) {
+        iniciado = true;
+        if (grafo.inicio != ATV_NULA && critica[grafo.inicio]) {
+            pilha.push_back(std::make_pair(grafo.inicio, grafo.sucBegin(grafo.inicio)));
+        }
+    } else if (!pilha.empty()) {
+        pilha.pop_back(); // fim: caminho entregue na chamada anterior
+    }
+
+    while (!pilha.empty()) {
+        auto &topo = pilha.back();
+
+        if (topo.first == grafo.fim) {
+            caminho.clear();
+            for (const auto &p : pilha) caminho.push_back(p.first);
+            return true;
+        }
+
+        // Próximo sucessor crítico por uma conexão justa
+        const auto fimSuc = grafo.sucEnd(topo.first);
+        while (topo.second != fimSuc &&
+               !(critica[*topo.second] && justa(topo.first, *topo.second))) {
+            ++topo.second;
+        }
+
+        if (topo.second == fimSuc) {
+            pilha.pop_back();
+            continue;
+        }
+
+        const auto prox = *topo.second++;
+        pilha.push_back(std::make_pair(prox, grafo.sucBegin(prox)));
+    }
+
+    return false;
+}
+
+MaioresCaminhos::MaioresCaminhos(const Grafo &g, const std::vector<int> &peso) : grafo(g) {
+
+    const auto n = g.tamanho();
+
+    longo.assign(n, 0);
+    proxima.assign(n, ATV_NULA);
+    inicioDesvios.assign(n + 1, 0);
+    heap.assign(n, 0);
+    nos.push_back(No{0, ATV_NULA, 0, 0, 0}); // 0: heap vazio
+
+    std::vector<AtvId> ordem;
+    if (g.inicio == ATV_NULA || g.fim == ATV_NULA || !ordenaTopologica(ordem, g)) {
+        return;
+    }
+
+    auto duracao = [&peso](AtvId v) { return std::max(peso[v], 0); };
+
+    // Volta: caminho mais longo até o fim (árvore) e desvios de cada atividade
+    std::vector<char> chega(n, 0);
+    chega[g.fim] = 1;
+    longo[g.fim] = duracao(g.fim);
+
+    for (auto it = ordem.rbegin(); it != ordem.rend(); ++it) {
+        const auto v = *it;
+        if (v == g.fim) continue;
+        for (auto s = g.sucBegin(v); s != g.sucEnd(v); ++s) {
+            if (chega[*s] && (!chega[v] || longo[*s] > longo[proxima[v]])) {
+                proxima[v] = *s;
+                chega[v] = 1;
+            }
+        }
+        if (chega[v]) longo[v] = duracao(v) + longo[proxima[v]];
+    }
+
+    for (AtvId v = 0; v < n; ++v) {
+        inicioDesvios[v] = static_cast<uint32_t>(desvios.size());
+        if (!chega[v] || v == g.fim) continue;
+
+        bool arvore = false;
+        for (auto s = g.sucBegin(v); s != g.sucEnd(v); ++s) {
+            if (!chega[*s]) continue;
+            if (*s == proxima[v] && !arvore) {
+                arvore = true; // a própria conexão da árvore (uma única vez)
+                continue;
+            }
+            desvios.push_back(Desvio{v, *s, longo[v] - duracao(v) - longo[*s]});
+        }
+
+        std::stable_sort(desvios.begin() + inicioDesvios[v], desvios.end(),
+                         [](const Desvio &a, const Desvio &b) { return a.perda < b.perda; });
+    }
+    inicioDesvios[n] = static_cast<uint32_t>(desvios.size());
+
+    // Heap de cada atividade = heap da próxima na árvore + seu melhor desvio
+    // (a próxima vem depois na ordem topológica: já construída)
+    for (auto it = ordem.rbegin(); it != ordem.rend(); ++it) {
+        const auto v = *it;
+        if (!chega[v] || v == g.fim) continue;
+
+        heap[v] = heap[proxima[v]];
+        if (inicioDesvios[v] != inicioDesvios[v + 1]) {
+            nos.push_back(No{desvios[inicioDesvios[v]].perda, v, 0, 0, 1});
+            heap[v] = une(heap[v], static_cast<uint32_t>(nos.size() - 1));
+        }
+    }
+}
+
+uint32_t MaioresCaminhos::une(uint32_t a, uint32_t b) {
+
+    if (0 == a) return b;
+    if (0 == b) return a;
+    if (nos[b].perda < nos[a].perda) std::swap(a, b);
+
+    // Persistente: copia a raiz em vez de alterá-la
+    nos.push_back(nos[a]);
+    const auto copia = static_cast<uint32_t>(nos.size() - 1);
+
+    const auto direita = une(nos[copia].direita, b);
+    auto &no = nos[copia];
+    no.direita = direita;
+    if (nos[no.esquerda].posto < nos[no.direita].posto) {
+        std::swap(no.esquerda, no.direita);
+    }
+    no.posto = nos[no.direita].posto + 1;
+    return copia;
+}
+
+const MaioresCaminhos::Desvio &MaioresCaminhos::desvio(const Estado &estado) const {
+    return desvios[inicioDesvios[nos[estado.no].atividade] + estado.ordem];
+}
+
+void MaioresCaminhos::empilha(int perda, uint32_t no, uint32_t ordem, uint32_t prefixo) {
+    estados.push_back(Estado{perda, no, ordem, prefixo});
+    fila.push_back(std::make_pair(perda, static_cast<uint32_t>(estados.size() - 1)));
+    std::push_heap(fila.begin(), fila.end(), std::greater<std::pair<int, uint32_t>>());
+}
+
+bool MaioresCaminhos::proximo(std::vector<AtvId> &caminho, int &duracao) {
+
+    if (grafo.inicio == ATV_NULA || ATV_NULA == proxima[grafo.inicio]) return false;
+
+    // Primeiro: o próprio caminho mais longo (nenhum desvio)
+    uint32_t atual = SEM_PREFIXO;
+
+    if (!iniciado) {
+        iniciado = true;
+        if (0 != heap[grafo.inicio]) {
+            empilha(nos[heap[grafo.inicio]].perda, heap[grafo.inicio], 0, SEM_PREFIXO);
+        }
+    } else {
+        if (fila.empty()) return false;
+
+        std::pop_heap(fila.begin(), fila.end(), std::greater<std::pair<int, uint32_t>>());
+        atual = fila.back().second;
+        fila.pop_back();
+
+        // Sucessores do estado: os filhos no heap e o próximo desvio da
+        // mesma atividade (substituem o desvio atual) e o melhor desvio
+        // depois dele (acrescentado)
+        const auto estado = estados[atual];
+        const auto &no = nos[estado.no];
+        const auto atividade = no.atividade;
+
+        if (0 == estado.ordem) {
+            for (const auto filho : {no.esquerda, no.direita}) {
+                if (0 != filho) {
+                    empilha(estado.perda - no.perda + nos[filho].perda, filho, 0, estado.prefixo);
+                }
+            }
+        }
+        if (inicioDesvios[atividade] + estado.ordem + 1 < inicioDesvios[atividade + 1]) {
+            const auto &seguinte = desvios[inicioDesvios[atividade] + estado.ordem + 1];
+            empilha(estado.perda - desvio(estado).perda + seguinte.perda,
+                    estado.no, estado.ordem + 1, estado.prefixo);
+        }
+        const auto depois = heap[desvio(estado).para];
+        if (0 != depois) {
+            empilha(estado.perda + nos[depois].perda, depois, 0, atual);
+        }
+    }
+
+    // Reconstrói o caminho: árvore até cada desvio, do inicio ao fim
+    std::vector<uint32_t> escolhidos;
+    for (auto e = atual; SEM_PREFIXO != e; e = estados[e].prefixo) {
+        escolhidos.push_back(e);
+    }
+
+    caminho.clear();
+    auto v = grafo.inicio;
+    for (auto it = escolhidos.rbegin(); it != escolhidos.rend(); ++it) {
+        const auto &d = desvio(estados[*it]);
+        for (; v != d.de; v = proxima[v]) caminho.push_back(v);
+        caminho.push_back(v);
+        v = d.para;
+    }
+    for (; v != grafo.fim; v = proxima[v]) caminho.push_back(v);
+    caminho.push_back(grafo.fim);
+
+    duracao = longo[grafo.inicio] - (SEM_PREFIXO == atual ? 0 : estados[atual].perda);
+    return true;
+}
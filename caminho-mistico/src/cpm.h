@@ -0,0 +1,227 @@
+/// Calculador de Caminho Critico
+/// Motor de cálculo (CPM): passagens de ida e volta sobre o grafo
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_CPM_H
+#define CAMINHO_MISTICO_CPM_H
+
+#include <cstdint>      // uint64_t, UINT32_MAX
+#include <utility>      // pair
+#include <vector>       // vector
+
+#include "grafo.h"      // Grafo, AtvId
+
+struct Estatisticas {
+    //std::string nome;
+    int peso = 0;
+    bool iniciada = false;
+    bool finalizada = false;
+    int earlyStart = 0;
+    int earlyFinish = 0;
+    int lateStart = 0;
+    int lateFinish = 0;
+    int slack = 0;
+};
+
+/// Estatísticas de todas as atividades (estrutura de vetores),
+/// indexadas pelo id da atividade
+struct Cronograma {
+    std::vector<int> earlyStart;
+    std::vector<int> earlyFinish;
+    std::vector<int> lateStart;
+    std::vector<int> lateFinish;
+    std::vector<int> slack;
+    std::vector<char> iniciada;
+    std::vector<char> finalizada;
+
+    /// Duração do projeto (peso do caminho crítico)
+    int duracao = 0;
+
+    /// Zera as estatísticas para n atividades
+    void inicializa(AtvId n);
+
+    /// Estatísticas de uma atividade (para exibição)
+    Estatisticas atividade(const Grafo &grafo, AtvId v) const;
+};
+
+/// Ordenação topológica (Kahn) em O(V+E)
+/// @param ordem atividades em ordem topológica
+/// @param grafo grafo de dependências
+/// @return false caso o grafo contenha um ciclo
+bool ordenaTopologica(std::vector<AtvId> &ordem, const Grafo &grafo);
+
+/// Marca as atividades que estão em algum caminho inicio -> fim
+/// (alcançáveis a partir do inicio e que chegam ao fim)
+/// @param noCaminho marcação de saída (1: no caminho)
+/// @param grafo grafo de dependências
+/// @param ordem atividades em ordem topológica
+void marcaCaminhos(std::vector<char> &noCaminho, const Grafo &grafo,
+                   const std::vector<AtvId> &ordem);
+
+/// Calcula ES, EF, LS, LF e slack de cada atividade em O(V+E)
+/// (ordenação topológica + passagem de ida + passagem de volta)
+/// Atividades fora de qualquer caminho inicio -> fim mantêm os valores nulos
+/// @param cronograma estatísticas calculadas
+/// @param grafo grafo de dependências
+/// @return false caso o grafo contenha um ciclo
+bool calculaCPM(Cronograma &cronograma, const Grafo &grafo);
+
+/// Todos os caminhos inicio -> fim sem materializá-los
+///
+/// Os caminhos compartilham prefixos: a única "árvore de caminhos" mantida é a
+/// pilha da busca em profundidade sobre os ids do grafo, de modo que a memória
+/// é O(V) + profundidade do caminho atual, e não a soma dos comprimentos
+/// (que pode crescer exponencialmente)
+///
+/// Ordem da listagem original: caminhos mais curtos primeiro e, entre caminhos
+/// de mesmo comprimento, a ordem da busca. Cada comprimento é uma busca
+/// própria, podada pelo menor/maior número de atividades até o fim
+class Caminhos {
+public:
+    /// @param grafo grafo de dependências (deve sobreviver ao objeto)
+    explicit Caminhos(const Grafo &grafo);
+
+    /// Extrai o próximo caminho
+    /// @param caminho ids do caminho, do inicio ao fim
+    /// @return false quando não houver mais caminhos
+    bool proximo(std::vector<AtvId> &caminho);
+
+private:
+    const Grafo &grafo;
+
+    /// Menor e maior quantidade de atividades de cada uma até o fim,
+    /// inclusive (0: não chega ao fim)
+    std::vector<uint32_t> menor;
+    std::vector<uint32_t> maior;
+
+    /// Comprimento (em atividades) da busca atual
+    uint32_t comprimento = 0;
+
+    /// Pilha da busca: {atividade, próximo sucessor}
+    std::vector<std::pair<AtvId, const AtvId *>> pilha;
+    bool iniciado = false;
+};
+
+/// Caminhos críticos sem enumerar todos os caminhos
+///
+/// Um caminho inicio -> fim é crítico quando todas as suas conexões são
+/// "justas" (EF da origem igual ao ES do destino): somente o subgrafo de
+/// folga zero é percorrido
+///     - quantidade: programação dinâmica em O(V+E), saturada em UINT64_MAX
+///     - proximo: busca em profundidade retomável, um caminho por chamada;
+///       memória O(V) + profundidade do caminho atual
+class CaminhosCriticos {
+public:
+    /// @param grafo grafo de dependências (deve sobreviver ao objeto)
+    /// @param cronograma cronograma calculado por calculaCPM (idem)
+    CaminhosCriticos(const Grafo &grafo, const Cronograma &cronograma);
+
+    /// Quantidade de caminhos críticos
+    uint64_t quantidade() const { return qtde; }
+
+    /// true caso a quantidade real ultrapasse UINT64_MAX
+    bool saturada() const { return saturou; }
+
+    /// Extrai o próximo caminho crítico
+    /// @param caminho ids do caminho, do inicio ao fim
+    /// @return false quando não houver mais caminhos
+    bool proximo(std::vector<AtvId> &caminho);
+
+private:
+    bool justa(AtvId de, AtvId para) const;
+
+    const Grafo &grafo;
+    const Cronograma &cronograma;
+
+    /// Atividades em algum caminho crítico
+    std::vector<char> critica;
+
+    uint64_t qtde = 0;
+    bool saturou = false;
+
+    /// Pilha da busca: {atividade, próximo sucessor}
+    std::vector<std::pair<AtvId, const AtvId *>> pilha;
+    bool iniciado = false;
+};
+
+/// Os k caminhos inicio -> fim mais longos, do maior para o menor, sem
+/// enumerar todos os caminhos (algoritmo de Eppstein sobre o grafo acíclico)
+///
+/// Todo caminho é o caminho mais longo até o fim com alguns "desvios":
+/// conexões fora da árvore dos caminhos mais longos, cada uma com a perda
+/// (em dias) de sair da árvore naquele ponto. Um heap persistente por
+/// atividade reúne os desvios disponíveis ao longo do seu caminho na árvore
+///     - construção: O(E log d + V log V) (d: maior grau de saída)
+///     - proximo: O(log k) + comprimento do caminho extraído
+class MaioresCaminhos {
+public:
+    /// @param grafo grafo de dependências (deve sobreviver ao objeto)
+    /// @param peso duração de cada atividade (negativas contam zero)
+    MaioresCaminhos(const Grafo &grafo, const std::vector<int> &peso);
+
+    /// Durações do grafo
+    explicit MaioresCaminhos(const Grafo &grafo) : MaioresCaminhos(grafo, grafo.peso) {}
+
+    /// Extrai o próximo caminho mais longo
+    /// @param caminho ids do caminho, do inicio ao fim
+    /// @param duracao soma das durações do caminho
+    /// @return false quando não houver mais caminhos
+    bool proximo(std::vector<AtvId> &caminho, int &duracao);
+
+private:
+    /// Desvio: conexão de -> para fora da árvore
+    struct Desvio {
+        AtvId de;
+        AtvId para;
+        int perda;
+    };
+
+    /// Nó do heap persistente (leftist): melhor desvio de uma atividade
+    struct No {
+        int perda;
+        AtvId atividade;
+        uint32_t esquerda;
+        uint32_t direita;
+        uint32_t posto;
+    };
+
+    /// Estado da busca: um desvio escolhido e os anteriores (prefixo)
+    struct Estado {
+        int perda;          // perda total do caminho
+        uint32_t no;        // nó do heap
+        uint32_t ordem;     // desvio da atividade do nó (ordem crescente de perda)
+        uint32_t prefixo;   // estado dos desvios anteriores (SEM_PREFIXO: nenhum)
+    };
+
+    static const uint32_t SEM_PREFIXO = UINT32_MAX;
+
+    uint32_t une(uint32_t a, uint32_t b);
+    const Desvio &desvio(const Estado &estado) const;
+    void empilha(int perda, uint32_t no, uint32_t ordem, uint32_t prefixo);
+
+    const Grafo &grafo;
+
+    /// Maior duração de cada atividade até o fim, inclusive
+    std::vector<int> longo;
+    /// Próxima atividade na árvore (ATV_NULA: não chega ao fim)
+    std::vector<AtvId> proxima;
+
+    /// Desvios agrupados por atividade, em ordem crescente de perda
+    std::vector<Desvio> desvios;
+    std::vector<uint32_t> inicioDesvios;
+
+    /// Heap persistente de cada atividade (0: vazio)
+    std::vector<No> nos;
+    std::vector<uint32_t> heap;
+
+    std::vector<Estado> estados;
+    /// Fila de prioridade (min-heap) de {perda, estado}
+    std::vector<std::pair<int, uint32_t>> fila;
+    bool iniciado = false;
+};
+
+#endif // CAMINHO_MISTICO_CPM_H
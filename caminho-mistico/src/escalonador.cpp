@@ -0,0 +1,278 @@
+/// Calculador de Caminho Critico
+/// Reprogramação incremental a partir da execução real dos dias
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "escalonador.h"
+
+#include <algorithm>    // max
+#include <utility>      // move
+
+bool Escalonador::inicializa(const Grafo &g, const Cronograma &cronograma) {
+
+    grafo = &g;
+
+    const auto n = g.tamanho();
+
+    std::vector<AtvId> ordem;
+    if (!ordenaTopologica(ordem, g)) {
+        return false; // ciclo
+    }
+
+    posicao.assign(n, 0);
+    for (uint32_t i = 0; i < ordem.size(); ++i) {
+        posicao[ordem[i]] = i;
+    }
+
+    marcaCaminhos(noCaminho, g, ordem);
+
+    prepara(cronograma);
+    return true;
+}
+
+void Escalonador::inicializa(const Grafo &g, const Cronograma &cronograma, const AtvId *ordem) {
+
+    grafo = &g;
+
+    const auto n = g.tamanho();
+
+    posicao.assign(n, 0);
+    for (uint32_t i = 0; i < n; ++i) {
+        posicao[ordem[i]] = i;
+    }
+
+    // Projeto válido: todas as atividades estão em algum caminho
+    noCaminho.assign(n, 1);
+
+    prepara(cronograma);
+}
+
+void Escalonador::prepara(const Cronograma &cronograma) {
+
+    const auto &g = *grafo;
+    const auto n = g.tamanho();
+
+    peso = g.peso;
+
+    es = cronograma.earlyStart;
+    ef = cronograma.earlyFinish;
+
+    // Cauda = duração + 1 - LS (ver calculaCPM)
+    cauda.assign(n, 0);
+    for (AtvId v = 0; v < n; ++v) {
+        if (noCaminho[v]) cauda[v] = cronograma.duracao + 1 - cronograma.lateStart[v];
+    }
+
+    inicioReal.assign(n, 0);
+    fimReal.assign(n, 0);
+    naIda.assign(n, 0);
+    naVolta.assign(n, 0);
+    ultimas = 0;
+    mudaram.clear();
+    tocada.assign(n, 0);
+    tocadas.clear();
+
+    // Capacidade final: cada atividade entra uma vez em cada fila e em
+    // tocadas, e no máximo duas vezes (ida e volta) em mudaram; a execução
+    // dos dias não aloca
+    std::vector<Item> itens;
+    itens.reserve(n);
+    filaIda = decltype(filaIda)(std::greater<Item>(), std::move(itens));
+    itens = std::vector<Item>();
+    itens.reserve(n);
+    filaVolta = decltype(filaVolta)(std::less<Item>(), std::move(itens));
+    mudaram.reserve(2 * static_cast<size_t>(n));
+    tocadas.reserve(n);
+}
+
+int Escalonador::duracao() const {
+    if (grafo->fim == ATV_NULA || !noCaminho[grafo->fim]) return 0;
+    return es[grafo->fim] - 1;
+}
+
+int Escalonador::duracaoEfetiva(AtvId v) const {
+    // Finalizada: duração real; caso contrário: duração estimada
+    if (fimReal[v]) return std::max(0, ef[v] - es[v]);
+    return peso[v] > 0 ? peso[v] : 0;
+}
+
+Estatisticas Escalonador::atividade(AtvId v) const {
+    Estatisticas e;
+    e.peso = peso[v];
+    e.iniciada = iniciada(v);
+    e.finalizada = finalizada(v);
+    e.earlyStart = earlyStart(v);
+    e.earlyFinish = earlyFinish(v);
+    e.lateStart = lateStart(v);
+    e.lateFinish = lateFinish(v);
+    e.slack = slack(v);
+    return e;
+}
+
+void Escalonador::inicia(AtvId v, int dia) {
+    inicioReal[v] = dia;
+    toca(v);
+    ultimas = 0;
+    mudaram.clear();
+    if (!noCaminho[v]) return;
+
+    enfileiraIda(v);
+    propaga();
+}
+
+void Escalonador::finaliza(AtvId v, int dia) {
+    fimReal[v] = dia;
+    toca(v);
+    ultimas = 0;
+    mudaram.clear();
+    if (!noCaminho[v]) return;
+
+    enfileiraIda(v);
+    propaga();
+}
+
+void Escalonador::redefineDuracao(AtvId v, int dias) {
+    ultimas = 0;
+    mudaram.clear();
+    if (peso[v] < 0 || peso[v] == dias) return; // extremos não têm duração
+    peso[v] = dias;
+    toca(v);
+    if (!noCaminho[v]) return;
+
+    // A ida compara a duração já alterada: a volta é enfileirada aqui
+    enfileiraIda(v);
+    enfileiraVolta(v);
+    propaga();
+}
+
+void Escalonador::toca(AtvId v) {
+    if (tocada[v]) return;
+    tocada[v] = 1;
+    tocadas.push_back(v);
+}
+
+void Escalonador::salva(std::vector<Registro> &registros) const {
+    registros.clear();
+    registros.reserve(tocadas.size());
+    for (const auto v : tocadas) {
+        registros.push_back(Registro{v, peso[v], es[v], ef[v], cauda[v], inicioReal[v], fimReal[v]});
+    }
+}
+
+void Escalonador::restaura(const std::vector<Registro> &registros, const Cronograma &cronograma) {
+
+    // Volta ao cronograma estático somente nas atividades alteradas
+    for (const auto v : tocadas) {
+        peso[v] = grafo->peso[v];
+        es[v] = cronograma.earlyStart[v];
+        ef[v] = cronograma.earlyFinish[v];
+        cauda[v] = noCaminho[v] ? cronograma.duracao + 1 - cronograma.lateStart[v] : 0;
+        inicioReal[v] = 0;
+        fimReal[v] = 0;
+        tocada[v] = 0;
+    }
+    tocadas.clear();
+
+    for (const auto &r : registros) {
+        const auto v = r.atividade;
+        peso[v] = r.peso;
+        es[v] = r.es;
+        ef[v] = r.ef;
+        cauda[v] = r.cauda;
+        inicioReal[v] = r.inicioReal;
+        fimReal[v] = r.fimReal;
+        toca(v);
+    }
+
+    ultimas = 0;
+    mudaram.clear();
+}
+
+void Escalonador::enfileiraIda(AtvId v) {
+    if (naIda[v]) return;
+    naIda[v] = 1;
+    filaIda.push(std::make_pair(posicao[v], v));
+}
+
+void Escalonador::enfileiraVolta(AtvId v) {
+    if (naVolta[v]) return;
+    naVolta[v] = 1;
+    filaVolta.push(std::make_pair(posicao[v], v));
+}
+
+void Escalonador::propaga() {
+
+    const auto &g = *grafo;
+
+    // Passagem de ida: em ordem topológica, somente enquanto EF mudar
+    while (!filaIda.empty()) {
+        const auto v = filaIda.top().second;
+        filaIda.pop();
+        naIda[v] = 0;
+        ++ultimas;
+
+        const auto duracaoAntes = duracaoEfetiva(v);
+
+        int novoES = 1;
+        if (inicioReal[v]) {
+            novoES = inicioReal[v];
+        } else if (v != g.inicio) {
+            for (auto a = g.antBegin(v); a != g.antEnd(v); ++a) {
+                if (noCaminho[*a] && *a != g.fim) novoES = std::max(novoES, ef[*a]);
+            }
+        }
+
+        const int pesoV = peso[v] > 0 ? peso[v] : 0;
+        const int novoEF = fimReal[v] ? fimReal[v] : novoES + pesoV;
+        const bool mudouEF = (novoEF != ef[v]);
+
+        if (mudouEF || novoES != es[v]) {
+            mudaram.push_back(v);
+            toca(v);
+        }
+
+        es[v] = novoES;
+        ef[v] = novoEF;
+
+        if (mudouEF && v != g.fim) {
+            for (auto s = g.sucBegin(v); s != g.sucEnd(v); ++s) {
+                if (noCaminho[*s]) enfileiraIda(*s);
+            }
+        }
+
+        if (duracaoEfetiva(v) != duracaoAntes) {
+            enfileiraVolta(v);
+        }
+    }
+
+    // Passagem de volta: em ordem topológica reversa, enquanto a cauda mudar
+    while (!filaVolta.empty()) {
+        const auto v = filaVolta.top().second;
+        filaVolta.pop();
+        naVolta[v] = 0;
+        ++ultimas;
+
+        int maior = 0;
+        if (v != g.fim) {
+            for (auto s = g.sucBegin(v); s != g.sucEnd(v); ++s) {
+                if (noCaminho[*s]) maior = std::max(maior, cauda[*s]);
+            }
+        }
+
+        const int nova = duracaoEfetiva(v) + maior;
+        if (nova == cauda[v]) continue;
+
+        cauda[v] = nova;
+        mudaram.push_back(v);
+        toca(v);
+
+        if (v != g.inicio) {
+            for (auto a = g.antBegin(v); a != g.antEnd(v); ++a) {
+                if (noCaminho[*a]) enfileiraVolta(*a);
+            }
+        }
+    }
+}
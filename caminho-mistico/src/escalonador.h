@@ -0,0 +1,144 @@
+/// Calculador de Caminho Critico
+/// Reprogramação incremental a partir da execução real dos dias
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_ESCALONADOR_H
+#define CAMINHO_MISTICO_ESCALONADOR_H
+
+#include <cstddef>      // size_t
+#include <functional>   // greater
+#include <queue>        // priority_queue
+#include <vector>       // vector
+
+#include "cpm.h"        // Cronograma, Estatisticas
+#include "grafo.h"      // Grafo, AtvId
+
+/// Escalonador dinâmico
+///
+/// Parte do cronograma estático e, a cada início/término real, fixa a data
+/// real da atividade e repropaga somente pela parte afetada do grafo:
+///     - ida: ES/EF para os sucessores, em ordem topológica, enquanto mudarem
+///     - volta: a "cauda" (maior duração até o fim) para os antecessores,
+///       somente quando a duração efetiva de uma atividade muda
+/// LS/LF são derivados da cauda e da duração prevista do projeto, de forma
+/// que uma mudança na data de término não exige percorrer todo o grafo
+class Escalonador {
+public:
+    /// Prepara o escalonador a partir do cronograma estático
+    /// @param grafo grafo de dependências (deve sobreviver ao escalonador)
+    /// @param cronograma cronograma calculado por calculaCPM
+    /// @return false caso o grafo contenha um ciclo
+    bool inicializa(const Grafo &grafo, const Cronograma &cronograma);
+
+    /// Prepara o escalonador com uma ordem topológica já conhecida (projeto
+    /// fixo, ver fixo.h): sem ordenação nem busca de caminhos
+    /// @param grafo grafo de dependências válido (todas as atividades em
+    ///        algum caminho inicio -> fim)
+    /// @param cronograma cronograma estático do grafo
+    /// @param ordem as n atividades em ordem topológica
+    void inicializa(const Grafo &grafo, const Cronograma &cronograma, const AtvId *ordem);
+
+    /// Registra o início real de uma atividade
+    /// @param v atividade
+    /// @param dia dia do início
+    void inicia(AtvId v, int dia);
+
+    /// Registra o término real de uma atividade
+    /// @param v atividade
+    /// @param dia dia do término
+    void finaliza(AtvId v, int dia);
+
+    /// Altera a duração estimada de uma atividade (simulação "e se")
+    /// O grafo não é alterado; a duração vale somente para este escalonador
+    /// @param v atividade
+    /// @param dias nova duração (>= 0)
+    void redefineDuracao(AtvId v, int dias);
+
+    int earlyStart(AtvId v) const { return es[v]; }
+    int earlyFinish(AtvId v) const { return ef[v]; }
+    int lateStart(AtvId v) const { return noCaminho[v] ? duracao() + 1 - cauda[v] : 0; }
+    int lateFinish(AtvId v) const { return noCaminho[v] ? lateStart(v) + duracaoEfetiva(v) : 0; }
+    int slack(AtvId v) const { return lateStart(v) - earlyStart(v); }
+    bool iniciada(AtvId v) const { return 0 != inicioReal[v]; }
+    bool finalizada(AtvId v) const { return 0 != fimReal[v]; }
+    /// A atividade está em algum caminho inicio -> fim
+    bool considerada(AtvId v) const { return 0 != noCaminho[v]; }
+    /// Duração estimada (pode ter sido alterada por redefineDuracao)
+    int duracaoEstimada(AtvId v) const { return peso[v]; }
+
+    /// Duração prevista do projeto
+    int duracao() const;
+
+    /// Estatísticas de uma atividade (para exibição)
+    Estatisticas atividade(AtvId v) const;
+
+    /// Quantidade de atividades recalculadas na última atualização
+    size_t recalculadas() const { return ultimas; }
+
+    /// Atividades cujas datas (ES/EF/cauda) mudaram na última atualização
+    /// (pode conter repetições)
+    const std::vector<AtvId> &alteradas() const { return mudaram; }
+
+    /// Estado de uma atividade alterada desde inicializa (ver salva)
+    struct Registro {
+        AtvId atividade;
+        int peso;
+        int es;
+        int ef;
+        int cauda;
+        int inicioReal;
+        int fimReal;
+    };
+
+    /// Salva o estado atual: somente as atividades que diferem do cronograma
+    /// estático (as demais são recuperadas dele)
+    /// @param registros estado de saída
+    void salva(std::vector<Registro> &registros) const;
+
+    /// Restaura um estado salvo, em O(alteradas + registros)
+    /// @param registros estado salvo por salva
+    /// @param cronograma o mesmo cronograma de inicializa
+    void restaura(const std::vector<Registro> &registros, const Cronograma &cronograma);
+
+private:
+    /// Datas, filas e capacidades a partir do cronograma (posicao e
+    /// noCaminho já preenchidos)
+    void prepara(const Cronograma &cronograma);
+    int duracaoEfetiva(AtvId v) const;
+    void propaga();
+    void enfileiraIda(AtvId v);
+    void enfileiraVolta(AtvId v);
+    void toca(AtvId v);
+
+    const Grafo *grafo = nullptr;
+
+    std::vector<uint32_t> posicao;  // posição na ordem topológica
+    std::vector<char> noCaminho;
+    std::vector<int> peso;          // cópia de grafo->peso (redefineDuracao)
+
+    std::vector<int> es;
+    std::vector<int> ef;
+    std::vector<int> cauda;
+    std::vector<int> inicioReal;    // 0: não iniciada
+    std::vector<int> fimReal;       // 0: não finalizada
+
+    /// Filas de propagação: ida (menor posição primeiro) e volta (maior primeiro)
+    typedef std::pair<uint32_t, AtvId> Item;
+    std::priority_queue<Item, std::vector<Item>, std::greater<Item>> filaIda;
+    std::priority_queue<Item> filaVolta;
+    std::vector<char> naIda;
+    std::vector<char> naVolta;
+
+    size_t ultimas = 0;
+    std::vector<AtvId> mudaram;
+
+    /// Atividades alteradas desde inicializa (sem repetições)
+    std::vector<char> tocada;
+    std::vector<AtvId> tocadas;
+};
+
+#endif // CAMINHO_MISTICO_ESCALONADOR_H
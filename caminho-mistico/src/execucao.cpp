@@ -0,0 +1,347 @@
+/// Calculador de Caminho Critico
+/// Execução dos dias: aplica os eventos e gera os alertas de cada dia
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "execucao.h"
+
+#include <algorithm>    // sort
+
+#include "instrumentacao.h" // conta
+
+bool Execucao::inicializa(const Grafo &g, const Cronograma &cronograma) {
+
+    grafo = &g;
+
+    if (!dinamico.inicializa(g, cronograma)) {
+        return false;
+    }
+
+    // Atividades (sem os extremos) em ordem alfabética, para exibição
+    porNome.clear();
+    for (AtvId v = 0; v < g.tamanho(); ++v) {
+        if (g.peso[v] != -1) porNome.push_back(v);
+    }
+    std::sort(porNome.begin(), porNome.end(),
+              [&g](AtvId a, AtvId b) { return g.nomes[a] < g.nomes[b]; });
+
+    prepara();
+    return true;
+}
+
+void Execucao::inicializa(const Grafo &g, const Cronograma &cronograma,
+                          const AtvId *ordem, const AtvId *alfabetica) {
+
+    grafo = &g;
+
+    dinamico.inicializa(g, cronograma, ordem);
+
+    size_t qtde = 0;
+    for (AtvId v = 0; v < g.tamanho(); ++v) {
+        if (g.peso[v] != -1) ++qtde;
+    }
+    porNome.assign(alfabetica, alfabetica + qtde);
+
+    prepara();
+}
+
+void Execucao::prepara() {
+
+    const auto &g = *grafo;
+
+    previsao = dinamico.duracao();
+
+    posicaoNome.assign(g.tamanho(), static_cast<uint32_t>(-1));
+    for (uint32_t i = 0; i < porNome.size(); ++i) {
+        posicaoNome[porNome[i]] = i;
+    }
+
+    const auto n = g.tamanho();
+    emExecucao.inicializa(porNome.size());
+    doDia.inicializa(porNome.size());
+    atraso.assign(n, 0);
+    comAtraso.clear();
+    ultimoDia = 0;
+
+    // Capacidade final: cada atividade no máximo uma vez em comAtraso e em
+    // pendentes; um início e um término de cada atividade em um mesmo dia
+    comAtraso.reserve(n);
+    pendente.assign(n, 0);
+    pendentes.clear();
+    pendentes.reserve(n);
+    avisos.clear();
+    avisos.reserve(2 * static_cast<size_t>(n));
+
+    // Calendários vazios com a capacidade final (montados no primeiro dia
+    // com alertas)
+    calendarioES.inicializa(n);
+    calendarioEF.inicializa(n);
+    calendarioLS.inicializa(n);
+    calendarioLF.inicializa(n);
+
+    calendariosAtuais = false;
+}
+
+void Execucao::montaCalendarios() {
+    const auto n = grafo->tamanho();
+    calendarioES.inicializa(n);
+    calendarioEF.inicializa(n);
+    calendarioLS.inicializa(n);
+    calendarioLF.inicializa(n);
+    for (const auto v : porNome) agenda(v);
+    for (const auto v : pendentes) pendente[v] = 0;
+    pendentes.clear();
+    calendariosAtuais = true;
+}
+
+void Execucao::agenda(AtvId v) {
+    if (!dinamico.considerada(v)) return;
+
+    // LS = duração + 1 - chave: a chave não muda com a duração do projeto
+    const auto base = dinamico.duracao() + 1;
+
+    if (dinamico.iniciada(v)) {
+        calendarioES.remove(v);
+        calendarioLS.remove(v);
+    } else {
+        calendarioES.agenda(v, dinamico.earlyStart(v));
+        calendarioLS.agenda(v, base - dinamico.lateStart(v));
+    }
+
+    if (dinamico.finalizada(v)) {
+        calendarioEF.remove(v);
+        calendarioLF.remove(v);
+    } else {
+        calendarioEF.agenda(v, dinamico.earlyFinish(v));
+        calendarioLF.agenda(v, base - dinamico.lateFinish(v));
+    }
+}
+
+void Execucao::reagenda(AtvId v) {
+    if (!calendariosAtuais) return;
+
+    // Reagendadas uma única vez por dia, antes da consulta dos marcos
+    auto marca = [this](AtvId a) {
+        if (pendente[a] || posicaoNome[a] == static_cast<uint32_t>(-1)) return;
+        pendente[a] = 1;
+        pendentes.push_back(a);
+    };
+
+    marca(v);
+    for (const auto a : dinamico.alteradas()) marca(a);
+}
+
+void Execucao::marcosDoDia(int dia) {
+    for (const auto v : pendentes) {
+        agenda(v);
+        pendente[v] = 0;
+    }
+    pendentes.clear();
+
+    const auto base = dinamico.duracao() + 1;
+
+    // Posições em porNome: em ordem alfabética, sem repetições
+    doDia.limpa();
+    const auto marca = [this](AtvId v) { doDia.insere(posicaoNome[v]); };
+    calendarioES.percorre(dia, marca);
+    calendarioEF.percorre(dia, marca);
+    calendarioLS.percorre(base - dia, marca);
+    calendarioLF.percorre(base - dia, marca);
+}
+
+void Execucao::marcaAtraso(AtvId v) {
+    if (atraso[v]) return;
+    atraso[v] = 1;
+    comAtraso.push_back(v);
+}
+
+void Execucao::salva(Ponto &ponto) const {
+    ponto.dia = ultimoDia;
+    dinamico.salva(ponto.datas);
+    ponto.emExecucao.clear();
+    emExecucao.percorre([&ponto](uint32_t pos) { ponto.emExecucao.push_back(pos); });
+    ponto.comAtraso = comAtraso;
+}
+
+void Execucao::restaura(const Ponto &ponto, const Cronograma &cronograma) {
+    dinamico.restaura(ponto.datas, cronograma);
+
+    emExecucao.limpa();
+    for (const auto pos : ponto.emExecucao) emExecucao.insere(pos);
+
+    for (const auto v : comAtraso) atraso[v] = 0;
+    comAtraso = ponto.comAtraso;
+    for (const auto v : comAtraso) atraso[v] = 1;
+
+    ultimoDia = ponto.dia;
+    previsao = dinamico.duracao();
+    calendariosAtuais = false;
+}
+
+void Execucao::avisa(AtvId v, bool inicio, int atrasoCedo, int atrasoTarde) {
+    // Mesma precedência da mensagem: no ES/EF, no LS/LF, antes do ES/EF,
+    // antes do LS/LF ou depois do LS/LF
+    const bool tarde = 0 != atrasoCedo && (0 == atrasoTarde || atrasoCedo > 0);
+    avisos.push_back(Aviso{v, inicio, tarde, tarde ? atrasoTarde : atrasoCedo});
+}
+
+void Execucao::atrasadas(std::vector<AtvId> &lista) const {
+    lista.clear();
+    for (const auto v : porNome) {
+        const bool vencidaLS = !dinamico.iniciada(v) && dinamico.lateStart(v) < ultimoDia;
+        const bool vencidaLF = !dinamico.finalizada(v) && dinamico.lateFinish(v) < ultimoDia;
+
+        if (atraso[v] || vencidaLS || vencidaLF) {
+            lista.push_back(v);
+        }
+    }
+}
+
+void Execucao::processaDia(const Day &d, std::ostream *out) {
+
+    ultimoDia = d.dia;
+    conta(Contador::Dias);
+
+    // Somente aplica os eventos (sem alertas); os calendários serão
+    // remontados caso um dia com alertas venha depois
+    if (nullptr == out) {
+        calendariosAtuais = false;
+        for (const auto atv : d.finalizadas) {
+            if (d.dia > dinamico.lateFinish(atv)) marcaAtraso(atv);
+            dinamico.finaliza(atv, d.dia);
+            if (posicaoNome[atv] != static_cast<uint32_t>(-1)) {
+                emExecucao.remove(posicaoNome[atv]);
+            }
+        }
+        for (const auto atv : d.iniciadas) {
+            if (d.dia > dinamico.lateStart(atv)) marcaAtraso(atv);
+            dinamico.inicia(atv, d.dia);
+            if (posicaoNome[atv] != static_cast<uint32_t>(-1) && !dinamico.finalizada(atv)) {
+                emExecucao.insere(posicaoNome[atv]);
+            }
+        }
+        previsao = dinamico.duracao();
+        return;
+    }
+
+    const auto &nomes = grafo->nomes;
+
+    if (!calendariosAtuais) montaCalendarios();
+
+    *out << "\nDia: " << d.dia << "\n";
+
+    // Alertas a serem impressos ao usuário (depois das listas do dia)
+    avisos.clear();
+
+    if (!d.finalizadas.empty()) {
+        *out << "Atividade(s) finalizada(s): ";
+        for (const auto atv : d.finalizadas) {
+            *out << nomes[atv] << ' ';
+
+            // Compara com a previsão e fixa a data real
+            const auto atrasoEF = d.dia - dinamico.earlyFinish(atv);
+            const auto atrasoLF = d.dia - dinamico.lateFinish(atv);
+            dinamico.finaliza(atv, d.dia);
+            reagenda(atv);
+
+            if (atrasoLF > 0) marcaAtraso(atv);
+
+            if (posicaoNome[atv] != static_cast<uint32_t>(-1)) {
+                emExecucao.remove(posicaoNome[atv]);
+            }
+
+            avisa(atv, false, atrasoEF, atrasoLF);
+        }
+        *out << "\n";
+    }
+
+    // Em execução: antes das que foram iniciadas no dia
+    if (!d.iniciadas.empty()) {
+        *out << "Atividade(s) iniciada(s): ";
+        for (const auto atv : d.iniciadas) {
+            *out << nomes[atv] << ' ';
+
+            // Compara com a previsão e fixa a data real
+            const auto atrasoES = d.dia - dinamico.earlyStart(atv);
+            const auto atrasoLS = d.dia - dinamico.lateStart(atv);
+            dinamico.inicia(atv, d.dia);
+            reagenda(atv);
+
+            if (atrasoLS > 0) marcaAtraso(atv);
+
+            avisa(atv, true, atrasoES, atrasoLS);
+        }
+        *out << "\n";
+    }
+
+    if (!emExecucao.vazio()) {
+        *out << "Atividade(s) ainda em execucao: ";
+        emExecucao.percorre([&](uint32_t pos) { *out << nomes[porNome[pos]] << ' '; });
+        *out << "\n";
+    }
+
+    // Entram no conjunto somente depois de exibidas as "ainda em execucao"
+    for (const auto atv : d.iniciadas) {
+        if (posicaoNome[atv] != static_cast<uint32_t>(-1) && !dinamico.finalizada(atv)) {
+            emExecucao.insere(posicaoNome[atv]);
+        }
+    }
+
+    *out << "\n";
+
+    for (const auto &a : avisos) {
+        const char *marco = a.inicio ? (a.tarde ? "LS" : "ES") : (a.tarde ? "LF" : "EF");
+        *out << "A atividade \"" << nomes[a.atividade] << "\" foi "
+             << (a.inicio ? "iniciada " : "finalizada ");
+
+        if (0 == a.dias) {
+            *out << "no seu " << marco << ".\n";
+        } else if (a.dias < 0) {
+            *out << -a.dias << " dia(s) antes do seu " << marco << ".\n";
+        } else {
+            *out << a.dias << " dia(s) depois do seu " << marco << ".\n";
+        }
+    }
+
+    // Somente as atividades com algum marco hoje (calendários)
+    marcosDoDia(d.dia);
+
+    doDia.percorre([&](uint32_t pos) {
+        const auto v = porNome[pos];
+        const auto &nome = nomes[v];
+        // Poderiam/deveriam ter sido iniciadas
+        if (!dinamico.iniciada(v)) {
+            if (dinamico.earlyStart(v) == d.dia) {
+                *out << "Hoje e o ES da atividade " << nome << ".\n";
+            }
+
+            if (dinamico.lateStart(v) == d.dia) {
+                *out << "Hoje e o LS da atividade " << nome << ".\n";
+            }
+        }
+        // Poderiam/deveriam ter sido finalizadas
+        if (!dinamico.finalizada(v)) {
+            if (dinamico.earlyFinish(v) == d.dia) {
+                *out << "Hoje e o EF da atividade " << nome << ".\n";
+            }
+
+            if (dinamico.lateFinish(v) == d.dia) {
+                *out << "Hoje e o LF da atividade " << nome << ".\n";
+            }
+        }
+    });
+
+    // Nova previsão de término (atividades não conclusas: novo projeto)
+    if (dinamico.duracao() != previsao) {
+        *out << "Nova previsao de duracao do projeto: " << dinamico.duracao()
+             << " (antes: " << previsao << ").\n";
+        previsao = dinamico.duracao();
+    }
+
+    *out << "\n";
+
+    *out << "\n---------------" << "\n";
+}
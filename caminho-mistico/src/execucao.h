@@ -0,0 +1,144 @@
+/// Calculador de Caminho Critico
+/// Execução dos dias: aplica os eventos e gera os alertas de cada dia
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_EXECUCAO_H
+#define CAMINHO_MISTICO_EXECUCAO_H
+
+#include <ostream>      // ostream
+#include <vector>       // vector
+
+#include "calendario.h" // Calendario
+#include "conjunto.h"   // ConjuntoBits
+#include "cpm.h"        // Cronograma
+#include "escalonador.h" // Escalonador
+#include "grafo.h"      // Grafo, AtvId
+#include "parser.h"     // Day
+
+/// Reprodução da execução do projeto, dia a dia
+///
+/// Mantém o conjunto das atividades em execução (atualizado a cada
+/// início/término) em vez de varrer todas as atividades a cada dia
+/// Os marcos do dia (ES, EF, LS, LF) vêm de calendários indexados pela
+/// data e reagendados somente para as atividades que o escalonador
+/// recalculou: o custo de um dia é proporcional aos seus eventos
+/// Todas as estruturas têm a capacidade final depois de inicializa: os dias
+/// são processados sem alocação dinâmica
+class Execucao {
+public:
+    /// Prepara a execução a partir do cronograma estático
+    /// @param grafo grafo de dependências (deve sobreviver à execução)
+    /// @param cronograma cronograma calculado por calculaCPM
+    /// @return false caso o grafo contenha um ciclo
+    bool inicializa(const Grafo &grafo, const Cronograma &cronograma);
+
+    /// Prepara a execução com as ordens já conhecidas (projeto fixo, ver
+    /// fixo.h): sem ordenação topológica, busca de caminhos nem ordenação
+    /// por nome
+    /// @param grafo grafo de dependências válido (deve sobreviver à execução)
+    /// @param cronograma cronograma estático do grafo
+    /// @param ordem as n atividades em ordem topológica
+    /// @param alfabetica atividades sem os extremos em ordem alfabética
+    void inicializa(const Grafo &grafo, const Cronograma &cronograma,
+                    const AtvId *ordem, const AtvId *alfabetica);
+
+    /// Aplica os eventos de um dia e escreve os alertas
+    /// @param d dia
+    /// @param out saída dos alertas (nullptr: somente aplica os eventos)
+    void processaDia(const Day &d, std::ostream *out);
+
+    /// Altera a duração estimada de uma atividade (ver Escalonador)
+    /// @param v atividade
+    /// @param dias nova duração
+    void redefineDuracao(AtvId v, int dias) {
+        dinamico.redefineDuracao(v, dias);
+        reagenda(v);
+    }
+
+    /// Atividades atrasadas até o último dia processado:
+    /// iniciadas depois do LS, finalizadas depois do LF ou que
+    /// ultrapassaram o LS/LF sem serem iniciadas/finalizadas
+    /// @param atrasadas atividades em ordem alfabética
+    void atrasadas(std::vector<AtvId> &atrasadas) const;
+
+    /// Atividades (sem os extremos) em ordem alfabética
+    const std::vector<AtvId> &atividades() const { return porNome; }
+
+    const Escalonador &escalonador() const { return dinamico; }
+
+    /// Último dia processado (0: nenhum)
+    int dia() const { return ultimoDia; }
+
+    /// Ponto de restauração compacto: somente o que difere do início
+    struct Ponto {
+        int dia = 0;
+        std::vector<Escalonador::Registro> datas;
+        std::vector<uint32_t> emExecucao;   // posições em porNome
+        std::vector<AtvId> comAtraso;
+    };
+
+    /// Salva o estado atual (datas, atividades em execução e atrasos)
+    /// @param ponto estado de saída
+    void salva(Ponto &ponto) const;
+
+    /// Restaura um estado salvo; os calendários são remontados no próximo
+    /// dia com alertas
+    /// @param ponto estado salvo por salva
+    /// @param cronograma o mesmo cronograma de inicializa
+    void restaura(const Ponto &ponto, const Cronograma &cronograma);
+
+private:
+    /// Estruturas da execução (dinamico e porNome já preparados)
+    void prepara();
+    /// Monta os calendários a partir das datas atuais (O(n))
+    void montaCalendarios();
+    /// Agenda os marcos de uma atividade nas datas atuais
+    void agenda(AtvId v);
+    /// Marca para reagendar a atividade do evento e as alteradas pelo escalonador
+    void reagenda(AtvId v);
+    /// Atividades (posições em porNome, em ordem) com algum marco no dia
+    void marcosDoDia(int dia);
+    /// Registra um evento após o LS/LF
+    void marcaAtraso(AtvId v);
+
+    /// Alerta de um início/término, escrito depois das listas do dia
+    struct Aviso {
+        AtvId atividade;
+        bool inicio;        // false: término
+        bool tarde;         // comparado ao LS/LF (false: ES/EF)
+        int dias;           // dia real - marco (0: no marco)
+    };
+
+    /// Compara o dia real com os marcos (ES/LS ou EF/LF) e guarda o alerta
+    void avisa(AtvId v, bool inicio, int atrasoCedo, int atrasoTarde);
+
+    const Grafo *grafo = nullptr;
+    Escalonador dinamico;
+
+    /// ES e EF indexados pelo dia; LS e LF pela "cauda" (LS = duração + 1 -
+    /// cauda), que não muda quando a duração prevista do projeto muda
+    Calendario calendarioES;
+    Calendario calendarioEF;
+    Calendario calendarioLS;
+    Calendario calendarioLF;
+    bool calendariosAtuais = false;     // mantidos somente nos dias com alertas
+    std::vector<char> pendente;         // alterada desde a última consulta
+    std::vector<AtvId> pendentes;
+    ConjuntoBits doDia;                 // posições em porNome
+
+    std::vector<AtvId> porNome;
+    std::vector<uint32_t> posicaoNome;  // id -> posição em porNome
+    ConjuntoBits emExecucao;            // posições em porNome
+    std::vector<char> atraso;           // evento registrado após LS/LF
+    std::vector<AtvId> comAtraso;       // atraso[v] == 1, na ordem dos eventos
+    int previsao = 0;
+    int ultimoDia = 0;
+
+    std::vector<Aviso> avisos;          // alertas dos eventos do dia
+};
+
+#endif // CAMINHO_MISTICO_EXECUCAO_H
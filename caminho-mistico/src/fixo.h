@@ -0,0 +1,544 @@
+/// Calculador de Caminho Critico
+/// Projeto fixo: cronograma estático calculado em tempo de compilação
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_FIXO_H
+#define CAMINHO_MISTICO_FIXO_H
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t
+
+#include "cpm.h"        // Cronograma
+#include "execucao.h"   // Execucao
+#include "grafo.h"      // Grafo, AtvId, ATV_NULA
+
+/// Atividade do cabeçalho de um projeto fixo ({nome, peso}; extremos: -1)
+struct AtividadeFixa {
+    const char *nome;
+    int peso;
+};
+
+/// Conexão {from, to} de um projeto fixo (nomes do cabeçalho)
+struct ConexaoFixa {
+    const char *de;
+    const char *para;
+};
+
+/// Vetor de tamanho fixo utilizável em expressões constantes (C++11)
+template<typename T, size_t N>
+struct VetorFixo {
+    T v[N];
+
+    constexpr const T &operator[](size_t i) const { return v[i]; }
+    const T *begin() const { return v; }
+    const T *end() const { return v + N; }
+};
+
+/// Sequência 0..N-1 para a expansão dos vetores (std::index_sequence é C++14)
+template<size_t... I>
+struct Indices {};
+
+template<size_t N, size_t... I>
+struct GeraIndices : GeraIndices<N - 1, N - 1, I...> {};
+
+template<size_t... I>
+struct GeraIndices<0, I...> {
+    typedef Indices<I...> Tipo;
+};
+
+/// Compara dois nomes (como std::string::operator==)
+constexpr bool nomesIguais(const char *a, const char *b) {
+    return *a == *b && ('\0' == *a || nomesIguais(a + 1, b + 1));
+}
+
+/// Ordem alfabética de dois nomes (como std::string::operator<)
+constexpr bool nomeMenor(const char *a, const char *b) {
+    return *a != *b ? static_cast<unsigned char>(*a) < static_cast<unsigned char>(*b)
+                    : ('\0' != *a && nomeMenor(a + 1, b + 1));
+}
+
+template<size_t N, size_t M>
+struct CalculoFixo;
+
+/// Projeto com cabeçalho e conexões conhecidos em tempo de compilação
+///
+/// Todas as tabelas que a leitura e calculaCPM produziriam em tempo de
+/// execução são constantes: listas CSR, ordem topológica, ordem alfabética,
+/// ES/EF/LS/LF/slack e a duração. Em tempo de execução resta somente a
+/// reprodução dos dias (Execucao::processaDia):
+///
+///     constexpr AtividadeFixa ATIVIDADES[] = {{"INICIO", -1}, {"A", 2}, {"FIM", -1}};
+///     constexpr ConexaoFixa CONEXOES[] = {{"INICIO", "A"}, {"A", "FIM"}};
+///     constexpr auto PROJETO = projetoFixo(ATIVIDADES, CONEXOES);
+///     static_assert(PROJETO.valido(), "projeto invalido");
+///
+/// As indicações de validade têm o significado de validaGrafo e devem ser
+/// conferidas com static_assert: as tabelas só correspondem ao calculaCPM
+/// de um projeto válido. Cada passagem de ida/volta é uma recursão
+/// constexpr: o maior caminho fica limitado pela profundidade de recursão
+/// do compilador (512 por padrão no GCC e no Clang; ver -fconstexpr-depth)
+template<size_t N, size_t M>
+struct ProjetoFixo {
+    VetorFixo<AtividadeFixa, N> atividades;
+    AtvId inicio;
+    AtvId fim;
+
+    /// Listas CSR, como Grafo (vizinhos na ordem das conexões)
+    VetorFixo<uint32_t, N + 1> sucInicio;
+    VetorFixo<AtvId, M> sucessores;
+    VetorFixo<uint32_t, N + 1> antInicio;
+    VetorFixo<AtvId, M> antecessores;
+
+    /// Ordem topológica (por profundidade, depois pelo id)
+    VetorFixo<AtvId, N> ordem;
+    /// Atividades sem os extremos em ordem alfabética (N - 2 primeiras)
+    VetorFixo<AtvId, N> alfabetica;
+
+    VetorFixo<int, N> earlyStart;
+    VetorFixo<int, N> earlyFinish;
+    VetorFixo<int, N> lateStart;
+    VetorFixo<int, N> lateFinish;
+    VetorFixo<int, N> slack;
+    int duracao;
+
+    /// Validação (ver validaGrafo)
+    bool extremosValidos;       // exatamente dois extremos (peso -1)
+    bool nomesUnicos;
+    bool conexoesConhecidas;    // nomes das conexões no cabeçalho
+    bool conexoesUnicas;
+    bool semCiclo;
+    bool todasNoCaminho;        // alcançáveis a partir do inicio e até o fim
+
+    constexpr bool valido() const {
+        return extremosValidos && nomesUnicos && conexoesConhecidas && conexoesUnicas &&
+               semCiclo && todasNoCaminho;
+    }
+
+    /// Id de uma atividade pelo nome (ATV_NULA caso não exista), para montar
+    /// os dias sem a leitura do texto
+    constexpr AtvId id(const char *nome) const {
+        return CalculoFixo<N, M>::busca(atividades.v, nome, 0, N);
+    }
+
+    /// Preenche o grafo e o cronograma estático com as tabelas (cópias, sem
+    /// leitura nem cálculo); o índice de nomes é montado para parseExecucao
+    /// @param grafo grafo de saída
+    /// @param cronograma cronograma de saída
+    void monta(Grafo &grafo, Cronograma &cronograma) const {
+        grafo = Grafo();
+        grafo.nomes.reserve(N);
+        grafo.peso.reserve(N);
+        for (const auto &a : atividades) {
+            grafo.nomes.push_back(a.nome);
+            grafo.peso.push_back(a.peso);
+        }
+        grafo.sucInicio.assign(sucInicio.begin(), sucInicio.end());
+        grafo.sucessores.assign(sucessores.begin(), sucessores.end());
+        grafo.antInicio.assign(antInicio.begin(), antInicio.end());
+        grafo.antecessores.assign(antecessores.begin(), antecessores.end());
+        grafo.inicio = inicio;
+        grafo.fim = fim;
+        grafo.indexa();
+
+        cronograma.inicializa(N);
+        cronograma.earlyStart.assign(earlyStart.begin(), earlyStart.end());
+        cronograma.earlyFinish.assign(earlyFinish.begin(), earlyFinish.end());
+        cronograma.lateStart.assign(lateStart.begin(), lateStart.end());
+        cronograma.lateFinish.assign(lateFinish.begin(), lateFinish.end());
+        cronograma.slack.assign(slack.begin(), slack.end());
+        cronograma.duracao = duracao;
+    }
+
+    /// Prepara a execução com as ordens constantes (sem ordenação topológica,
+    /// busca de caminhos nem ordenação por nome)
+    /// @param execucao execução de saída
+    /// @param grafo grafo preenchido por monta (deve sobreviver à execução)
+    /// @param cronograma cronograma preenchido por monta
+    void inicializa(Execucao &execucao, const Grafo &grafo, const Cronograma &cronograma) const {
+        execucao.inicializa(grafo, cronograma, ordem.v, alfabetica.v);
+    }
+};
+
+/// Passagens do cálculo em tempo de compilação (uma função por etapa: em
+/// C++11 uma função constexpr é uma única expressão)
+///
+/// Listas e contagens usam recursão por metades (profundidade log); ida e
+/// volta repetem passagens completas até que nada mude (no máximo N + 1)
+template<size_t N, size_t M>
+struct CalculoFixo {
+    typedef VetorFixo<int, N> Valores;
+    typedef VetorFixo<AtvId, M> Ligacoes;
+    typedef VetorFixo<uint32_t, N + 1> Inicios;
+    typedef typename GeraIndices<N>::Tipo IndicesN;
+    typedef typename GeraIndices<N + 1>::Tipo IndicesInicios;
+    typedef typename GeraIndices<M>::Tipo IndicesM;
+
+    /// Grafo já resolvido em ids
+    struct Contexto {
+        const AtividadeFixa *atividades;
+        AtvId inicio;
+        AtvId fim;
+        Inicios sucInicio;
+        Ligacoes sucessores;
+        Inicios antInicio;
+        Ligacoes antecessores;
+    };
+
+    /// Etapas que repetem passagens até convergir
+    struct Profundidade {};
+    struct Ida {};
+    struct Volta {};
+    struct Alcanca {};
+    struct ChegaAoFim {};
+
+    static constexpr size_t meio(size_t de, size_t ate) { return de + (ate - de) / 2; }
+    static constexpr AtvId menorId(AtvId a, AtvId b) { return a < b ? a : b; }
+    static constexpr int maior(int a, int b) { return a > b ? a : b; }
+
+    static constexpr int peso(const AtividadeFixa *a, AtvId v) {
+        return a[v].peso > 0 ? a[v].peso : 0;
+    }
+
+    // ---- Cabeçalho
+
+    /// Menor id com o nome em [de, ate) (ATV_NULA: nenhum)
+    static constexpr AtvId busca(const AtividadeFixa *a, const char *nome, size_t de, size_t ate) {
+        return 1 == ate - de ? (nomesIguais(a[de].nome, nome) ? static_cast<AtvId>(de) : ATV_NULA)
+                             : menorId(busca(a, nome, de, meio(de, ate)),
+                                       busca(a, nome, meio(de, ate), ate));
+    }
+
+    /// Primeiro extremo (peso -1) com id >= desde, em [de, ate)
+    static constexpr AtvId extremo(const AtividadeFixa *a, size_t desde, size_t de, size_t ate) {
+        return 1 == ate - de ? (de >= desde && -1 == a[de].peso ? static_cast<AtvId>(de) : ATV_NULA)
+                             : menorId(extremo(a, desde, de, meio(de, ate)),
+                                       extremo(a, desde, meio(de, ate), ate));
+    }
+
+    static constexpr size_t contaExtremos(const AtividadeFixa *a, size_t de, size_t ate) {
+        return 1 == ate - de ? (-1 == a[de].peso ? 1 : 0)
+                             : contaExtremos(a, de, meio(de, ate)) + contaExtremos(a, meio(de, ate), ate);
+    }
+
+    /// Outra atividade com o nome de v em [de, ate)
+    static constexpr bool repetido(const AtividadeFixa *a, size_t v, size_t de, size_t ate) {
+        return 1 == ate - de ? de != v && nomesIguais(a[de].nome, a[v].nome)
+                             : repetido(a, v, de, meio(de, ate)) || repetido(a, v, meio(de, ate), ate);
+    }
+
+    static constexpr bool semRepetidos(const AtividadeFixa *a, size_t de, size_t ate) {
+        return 1 == ate - de ? !repetido(a, de, 0, N)
+                             : semRepetidos(a, de, meio(de, ate)) && semRepetidos(a, meio(de, ate), ate);
+    }
+
+    template<size_t... I>
+    static constexpr VetorFixo<AtividadeFixa, N> copia(const AtividadeFixa *a, Indices<I...>) {
+        return VetorFixo<AtividadeFixa, N>{{a[I]...}};
+    }
+
+    // ---- Conexões
+
+    template<size_t... I>
+    static constexpr Ligacoes origens(const ConexaoFixa *c, const AtividadeFixa *a, Indices<I...>) {
+        return Ligacoes{{busca(a, c[I].de, 0, N)...}};
+    }
+
+    template<size_t... I>
+    static constexpr Ligacoes destinos(const ConexaoFixa *c, const AtividadeFixa *a, Indices<I...>) {
+        return Ligacoes{{busca(a, c[I].para, 0, N)...}};
+    }
+
+    static constexpr bool conhecidas(const Ligacoes &de, const Ligacoes &para, size_t i, size_t f) {
+        return 1 == f - i ? ATV_NULA != de[i] && ATV_NULA != para[i]
+                          : conhecidas(de, para, i, meio(i, f)) && conhecidas(de, para, meio(i, f), f);
+    }
+
+    /// Conexão anterior a e igual a ela em [i, f)
+    static constexpr bool duplicada(const Ligacoes &de, const Ligacoes &para, size_t e,
+                                    size_t i, size_t f) {
+        return 1 == f - i ? i < e && de[i] == de[e] && para[i] == para[e]
+                          : duplicada(de, para, e, i, meio(i, f)) || duplicada(de, para, e, meio(i, f), f);
+    }
+
+    static constexpr bool semDuplicadas(const Ligacoes &de, const Ligacoes &para, size_t i, size_t f) {
+        return 1 == f - i ? !duplicada(de, para, i, 0, M)
+                          : semDuplicadas(de, para, i, meio(i, f)) && semDuplicadas(de, para, meio(i, f), f);
+    }
+
+    // ---- Listas CSR (chave: origem para os sucessores, destino para os antecessores)
+
+    /// Conexões com chave < v em [i, f)
+    static constexpr uint32_t contaMenores(const Ligacoes &chave, size_t v, size_t i, size_t f) {
+        return 1 == f - i ? (chave[i] < v ? 1 : 0)
+                          : contaMenores(chave, v, i, meio(i, f)) + contaMenores(chave, v, meio(i, f), f);
+    }
+
+    /// Conexões com chave == v em [i, f)
+    static constexpr uint32_t contaIguais(const Ligacoes &chave, AtvId v, size_t i, size_t f) {
+        return 1 == f - i ? (chave[i] == v ? 1 : 0)
+                          : contaIguais(chave, v, i, meio(i, f)) + contaIguais(chave, v, meio(i, f), f);
+    }
+
+    template<size_t... I>
+    static constexpr Inicios inicios(const Ligacoes &chave, Indices<I...>) {
+        return Inicios{{contaMenores(chave, I, 0, M)...}};
+    }
+
+    /// j-ésima conexão (na ordem do projeto) com chave v em [i, f)
+    static constexpr size_t seleciona(const Ligacoes &chave, AtvId v, uint32_t j, size_t i, size_t f) {
+        return 1 == f - i ? i
+                          : j < contaIguais(chave, v, i, meio(i, f))
+                            ? seleciona(chave, v, j, i, meio(i, f))
+                            : seleciona(chave, v, j - contaIguais(chave, v, i, meio(i, f)), meio(i, f), f);
+    }
+
+    /// Atividade cuja lista contém a posição k (maior v com inicio[v] <= k)
+    static constexpr AtvId dona(const Inicios &inicio, uint32_t k, size_t de, size_t ate) {
+        return 1 == ate - de ? static_cast<AtvId>(de)
+                             : inicio[meio(de, ate)] <= k ? dona(inicio, k, meio(de, ate), ate)
+                                                          : dona(inicio, k, de, meio(de, ate));
+    }
+
+    static constexpr AtvId vizinho(const Ligacoes &chave, const Ligacoes &outro,
+                                   const Inicios &inicio, uint32_t k, AtvId v) {
+        return outro[seleciona(chave, v, k - inicio[v], 0, M)];
+    }
+
+    template<size_t... I>
+    static constexpr Ligacoes vizinhos(const Ligacoes &chave, const Ligacoes &outro,
+                                       const Inicios &inicio, Indices<I...>) {
+        return Ligacoes{{(I < inicio[N] ? vizinho(chave, outro, inicio, I, dona(inicio, I, 0, N))
+                                        : ATV_NULA)...}};
+    }
+
+    // ---- Passagens (valores por atividade)
+
+    /// Maior valor[lista[k]] + soma em [i, f) de uma lista CSR (vazia: nada)
+    static constexpr int maiorNaLista(const Valores &valor, const Ligacoes &lista, int soma,
+                                      int nada, uint32_t i, uint32_t f) {
+        return i == f ? nada
+                      : 1 == f - i ? valor[lista[i]] + soma
+                                   : maior(maiorNaLista(valor, lista, soma, nada, i, (i + f) / 2),
+                                           maiorNaLista(valor, lista, soma, nada, (i + f) / 2, f));
+    }
+
+    /// Maior EF das antecessoras (exceto o fim) em [i, f); 1: primeiro dia
+    static constexpr int maiorEF(const Contexto &c, const Valores &es, uint32_t i, uint32_t f) {
+        return i == f ? 1
+                      : 1 == f - i ? (c.antecessores[i] == c.fim
+                                      ? 1 : es[c.antecessores[i]] + peso(c.atividades, c.antecessores[i]))
+                                   : maior(maiorEF(c, es, i, (i + f) / 2), maiorEF(c, es, (i + f) / 2, f));
+    }
+
+    /// Alguma antecessora (exceto o fim) marcada em [i, f)
+    static constexpr bool antecessoraMarcada(const Contexto &c, const Valores &marca, uint32_t i, uint32_t f) {
+        return i == f ? false
+                      : 1 == f - i ? c.antecessores[i] != c.fim && 0 != marca[c.antecessores[i]]
+                                   : antecessoraMarcada(c, marca, i, (i + f) / 2) ||
+                                     antecessoraMarcada(c, marca, (i + f) / 2, f);
+    }
+
+    /// Alguma sucessora marcada em [i, f)
+    static constexpr bool sucessoraMarcada(const Contexto &c, const Valores &marca, uint32_t i, uint32_t f) {
+        return i == f ? false
+                      : 1 == f - i ? 0 != marca[c.sucessores[i]]
+                                   : sucessoraMarcada(c, marca, i, (i + f) / 2) ||
+                                     sucessoraMarcada(c, marca, (i + f) / 2, f);
+    }
+
+    /// Profundidade: maior quantidade de conexões desde uma atividade sem antecessoras
+    template<size_t... I>
+    static constexpr Valores passo(Profundidade, const Contexto &c, const Valores &p, Indices<I...>) {
+        return Valores{{maiorNaLista(p, c.antecessores, 1, 0, c.antInicio[I], c.antInicio[I + 1])...}};
+    }
+
+    /// ES = maior EF das antecessoras (1: primeiro dia)
+    template<size_t... I>
+    static constexpr Valores passo(Ida, const Contexto &c, const Valores &es, Indices<I...>) {
+        return Valores{{(I == c.inicio ? 1 : maiorEF(c, es, c.antInicio[I], c.antInicio[I + 1]))...}};
+    }
+
+    /// Cauda = peso + maior cauda das sucessoras (ver calculaCPM)
+    template<size_t... I>
+    static constexpr Valores passo(Volta, const Contexto &c, const Valores &cauda, Indices<I...>) {
+        return Valores{{(peso(c.atividades, I) +
+                         (I == c.fim ? 0 : maiorNaLista(cauda, c.sucessores, 0, 0,
+                                                        c.sucInicio[I], c.sucInicio[I + 1])))...}};
+    }
+
+    /// Alcançável a partir do inicio (ver marcaCaminhos)
+    template<size_t... I>
+    static constexpr Valores passo(Alcanca, const Contexto &c, const Valores &a, Indices<I...>) {
+        return Valores{{(I == c.inicio || antecessoraMarcada(c, a, c.antInicio[I], c.antInicio[I + 1])
+                         ? 1 : 0)...}};
+    }
+
+    /// Chega ao fim (ver marcaCaminhos)
+    template<size_t... I>
+    static constexpr Valores passo(ChegaAoFim, const Contexto &c, const Valores &a, Indices<I...>) {
+        return Valores{{(I == c.fim || (I != c.fim && sucessoraMarcada(c, a, c.sucInicio[I], c.sucInicio[I + 1]))
+                         ? 1 : 0)...}};
+    }
+
+    static constexpr bool iguais(const Valores &a, const Valores &b, size_t de, size_t ate) {
+        return 1 == ate - de ? a[de] == b[de]
+                             : iguais(a, b, de, meio(de, ate)) && iguais(a, b, meio(de, ate), ate);
+    }
+
+    /// Repete a passagem até que nada mude (ou esgotar as passagens: ciclo)
+    template<typename Etapa>
+    static constexpr Valores converge(Etapa etapa, const Contexto &c, const Valores &atual,
+                                      const Valores &proxima, size_t restantes) {
+        return 0 == restantes || iguais(atual, proxima, 0, N)
+               ? proxima
+               : converge(etapa, c, proxima, passo(etapa, c, proxima, IndicesN()), restantes - 1);
+    }
+
+    template<typename Etapa>
+    static constexpr Valores converge(Etapa etapa, const Contexto &c) {
+        return converge(etapa, c, Valores{{}}, passo(etapa, c, Valores{{}}, IndicesN()), N + 1);
+    }
+
+    static constexpr bool todasMarcadas(const Valores &a, const Valores &b, size_t de, size_t ate) {
+        return 1 == ate - de ? 0 != a[de] && 0 != b[de]
+                             : todasMarcadas(a, b, de, meio(de, ate)) && todasMarcadas(a, b, meio(de, ate), ate);
+    }
+
+    // ---- Ordens
+
+    /// Atividades antes de v na ordem topológica (profundidade, id) em [de, ate)
+    static constexpr int antesNaOrdem(const Valores &p, size_t v, size_t de, size_t ate) {
+        return 1 == ate - de ? (p[de] < p[v] || (p[de] == p[v] && de < v) ? 1 : 0)
+                             : antesNaOrdem(p, v, de, meio(de, ate)) + antesNaOrdem(p, v, meio(de, ate), ate);
+    }
+
+    template<size_t... I>
+    static constexpr Valores posicoesTopologicas(const Valores &p, Indices<I...>) {
+        return Valores{{antesNaOrdem(p, I, 0, N)...}};
+    }
+
+    /// Atividades antes de v em ordem alfabética em [de, ate); extremos no final
+    static constexpr int antesNoAlfabeto(const AtividadeFixa *a, size_t v, size_t de, size_t ate) {
+        return 1 == ate - de
+               ? ((-1 == a[v].peso) == (-1 == a[de].peso)
+                  ? (-1 == a[v].peso ? (de < v ? 1 : 0) : (nomeMenor(a[de].nome, a[v].nome) ? 1 : 0))
+                  : (-1 == a[v].peso ? 1 : 0))
+               : antesNoAlfabeto(a, v, de, meio(de, ate)) + antesNoAlfabeto(a, v, meio(de, ate), ate);
+    }
+
+    template<size_t... I>
+    static constexpr Valores posicoesAlfabeticas(const AtividadeFixa *a, Indices<I...>) {
+        return Valores{{antesNoAlfabeto(a, I, 0, N)...}};
+    }
+
+    /// Id com a posição k em [de, ate) (ATV_NULA: nenhum)
+    static constexpr AtvId naPosicao(const Valores &posicao, int k, size_t de, size_t ate) {
+        return 1 == ate - de ? (posicao[de] == k ? static_cast<AtvId>(de) : ATV_NULA)
+                             : menorId(naPosicao(posicao, k, de, meio(de, ate)),
+                                       naPosicao(posicao, k, meio(de, ate), ate));
+    }
+
+    template<size_t... I>
+    static constexpr VetorFixo<AtvId, N> inverte(const Valores &posicao, Indices<I...>) {
+        return VetorFixo<AtvId, N>{{naPosicao(posicao, static_cast<int>(I), 0, N)...}};
+    }
+
+    // ---- Datas
+
+    template<size_t... I>
+    static constexpr Valores somaPeso(const AtividadeFixa *a, const Valores &v, Indices<I...>) {
+        return Valores{{(v[I] + peso(a, I))...}};
+    }
+
+    template<size_t... I>
+    static constexpr Valores inicioTardio(const Valores &cauda, int duracao, Indices<I...>) {
+        return Valores{{(duracao + 1 - cauda[I])...}};
+    }
+
+    template<size_t... I>
+    static constexpr Valores diferenca(const Valores &a, const Valores &b, Indices<I...>) {
+        return Valores{{(a[I] - b[I])...}};
+    }
+
+    // ---- Etapas (cada uma recebe os resultados das anteriores)
+
+    static constexpr ProjetoFixo<N, M> calcula(const AtividadeFixa *a, const ConexaoFixa *c) {
+        return comLigacoes(a, origens(c, a, IndicesM()), destinos(c, a, IndicesM()));
+    }
+
+    static constexpr ProjetoFixo<N, M> comLigacoes(const AtividadeFixa *a, const Ligacoes &de,
+                                                  const Ligacoes &para) {
+        return comInicios(a, de, para, inicios(de, IndicesInicios()), inicios(para, IndicesInicios()));
+    }
+
+    static constexpr ProjetoFixo<N, M> comInicios(const AtividadeFixa *a, const Ligacoes &de,
+                                                 const Ligacoes &para, const Inicios &sucInicio,
+                                                 const Inicios &antInicio) {
+        return comContexto(a, de, para, Contexto{
+                a, extremo(a, 0, 0, N), extremo(a, extremo(a, 0, 0, N) + 1, 0, N),
+                sucInicio, vizinhos(de, para, sucInicio, IndicesM()),
+                antInicio, vizinhos(para, de, antInicio, IndicesM())});
+    }
+
+    static constexpr ProjetoFixo<N, M> comContexto(const AtividadeFixa *a, const Ligacoes &de,
+                                                  const Ligacoes &para, const Contexto &c) {
+        return comPassagens(a, de, para, c, converge(Profundidade(), c), converge(Ida(), c),
+                            converge(Volta(), c), converge(Alcanca(), c), converge(ChegaAoFim(), c));
+    }
+
+    static constexpr ProjetoFixo<N, M> comPassagens(const AtividadeFixa *a, const Ligacoes &de,
+                                                   const Ligacoes &para, const Contexto &c,
+                                                   const Valores &profundidade, const Valores &es,
+                                                   const Valores &cauda, const Valores &alcancavel,
+                                                   const Valores &chegaAoFim) {
+        return comDuracao(a, de, para, c, profundidade, es, cauda, alcancavel, chegaAoFim,
+                          ATV_NULA == c.fim ? 0 : es[c.fim] - 1);
+    }
+
+    static constexpr ProjetoFixo<N, M> comDuracao(const AtividadeFixa *a, const Ligacoes &de,
+                                                 const Ligacoes &para, const Contexto &c,
+                                                 const Valores &profundidade, const Valores &es,
+                                                 const Valores &cauda, const Valores &alcancavel,
+                                                 const Valores &chegaAoFim, int duracao) {
+        return final(a, de, para, c, profundidade, es, alcancavel, chegaAoFim, duracao,
+                     inicioTardio(cauda, duracao, IndicesN()));
+    }
+
+    static constexpr ProjetoFixo<N, M> final(const AtividadeFixa *a, const Ligacoes &de,
+                                            const Ligacoes &para, const Contexto &c,
+                                            const Valores &profundidade, const Valores &es,
+                                            const Valores &alcancavel, const Valores &chegaAoFim,
+                                            int duracao, const Valores &ls) {
+        return ProjetoFixo<N, M>{
+                copia(a, IndicesN()), c.inicio, c.fim,
+                c.sucInicio, c.sucessores, c.antInicio, c.antecessores,
+                inverte(posicoesTopologicas(profundidade, IndicesN()), IndicesN()),
+                inverte(posicoesAlfabeticas(a, IndicesN()), IndicesN()),
+                es, somaPeso(a, es, IndicesN()), ls, somaPeso(a, ls, IndicesN()),
+                diferenca(ls, es, IndicesN()), duracao,
+                2 == contaExtremos(a, 0, N),
+                semRepetidos(a, 0, N),
+                conhecidas(de, para, 0, M),
+                semDuplicadas(de, para, 0, M),
+                iguais(profundidade, passo(Profundidade(), c, profundidade, IndicesN()), 0, N),
+                todasMarcadas(alcancavel, chegaAoFim, 0, N)};
+    }
+};
+
+/// Calcula um projeto fixo em tempo de compilação
+/// @param atividades cabeçalho (a ordem define os ids, como na leitura)
+/// @param conexoes conexões {from, to}
+/// @return tabelas constantes do projeto (conferir valido() com static_assert)
+template<size_t N, size_t M>
+constexpr ProjetoFixo<N, M> projetoFixo(const AtividadeFixa (&atividades)[N],
+                                        const ConexaoFixa (&conexoes)[M]) {
+    static_assert(N >= 2 && M >= 1, "projeto fixo: ao menos os extremos e uma conexao");
+    static_assert(N < MAX_ATIVIDADES, "projeto fixo: atividades demais para AtvId");
+    return CalculoFixo<N, M>::calcula(atividades, conexoes);
+}
+
+#endif // CAMINHO_MISTICO_FIXO_H
@@ -0,0 +1,217 @@
+/// Calculador de Caminho Critico
+/// Gerador de projetos sintéticos (arquivos de entrada válidos)
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "gerador.h"
+
+#include <algorithm>    // max
+#include <cmath>        // sqrt
+#include <random>       // mt19937_64
+#include <unordered_set> // unordered_set
+#include <utility>      // pair
+#include <vector>       // vector
+
+namespace {
+
+typedef std::pair<uint32_t, uint32_t> Par;
+
+/// Gera um bloco série-paralelo sobre os ids [lo, hi)
+/// Todas as conexões vão de um id menor para um maior (grafo acíclico)
+/// @return {origem, destino} do bloco
+Par serieParalelo(std::vector<Par> &pares, uint32_t lo, uint32_t hi,
+                  std::mt19937_64 &rng) {
+
+    const auto n = hi - lo;
+
+    if (n <= 2) {
+        if (2 == n) pares.push_back(Par(lo, lo + 1));
+        return Par(lo, hi - 1);
+    }
+
+    if (n < 4 || rng() % 2) {
+        // Série: destino do primeiro -> origem do segundo
+        const auto meio = lo + 1 + static_cast<uint32_t>(rng() % (n - 1));
+        const auto a = serieParalelo(pares, lo, meio, rng);
+        const auto b = serieParalelo(pares, meio, hi, rng);
+        pares.push_back(Par(a.second, b.first));
+        return Par(a.first, b.second);
+    }
+
+    // Paralelo: lo (fork) -> ramos -> hi - 1 (join)
+    const auto fork = lo;
+    const auto join = hi - 1;
+    const auto internos = n - 2;
+    const auto ramos = std::min<uint32_t>(internos, 2 + static_cast<uint32_t>(rng() % 3));
+
+    auto de = lo + 1;
+    for (uint32_t r = 0; r < ramos; ++r) {
+        const auto restantes = join - de;
+        const auto tam = (r + 1 == ramos) ? restantes : std::max<uint32_t>(1, restantes / (ramos - r));
+        const auto b = serieParalelo(pares, de, de + tam, rng);
+        pares.push_back(Par(fork, b.first));
+        pares.push_back(Par(b.second, join));
+        de += tam;
+    }
+    return Par(fork, join);
+}
+
+} // namespace
+
+bool leForma(const std::string &nome, Forma &forma) {
+    if (nome == "cadeia") forma = Forma::Cadeia;
+    else if (nome == "leque") forma = Forma::Leque;
+    else if (nome == "camadas") forma = Forma::Camadas;
+    else if (nome == "serie-paralelo") forma = Forma::SerieParalelo;
+    else return false;
+    return true;
+}
+
+void geraProjeto(std::ostream &out, const ParametrosGerador &parametros) {
+
+    std::mt19937_64 rng(parametros.semente);
+
+    // 0: inicio, 1..n: A1..An, n + 1: fim
+    const uint32_t n = std::max<uint32_t>(parametros.atividades, 1);
+    const uint32_t inicio = 0;
+    const uint32_t fim = n + 1;
+
+    std::vector<int> duracao(n + 2, -1);
+    for (uint32_t v = 1; v <= n; ++v) {
+        duracao[v] = 1 + static_cast<int>(rng() % std::max(parametros.duracaoMaxima, 1));
+    }
+
+    // Três pontos: otimista em [1, provável], pessimista em [provável, 2 * provável]
+    std::vector<int> otimista, pessimista;
+    if (parametros.tresPontos) {
+        otimista.assign(n + 2, -1);
+        pessimista.assign(n + 2, -1);
+        for (uint32_t v = 1; v <= n; ++v) {
+            otimista[v] = 1 + static_cast<int>(rng() % duracao[v]);
+            pessimista[v] = duracao[v] + static_cast<int>(rng() % (duracao[v] + 1));
+        }
+    }
+
+    std::vector<Par> pares;
+
+    switch (parametros.forma) {
+        case Forma::Cadeia:
+            for (uint32_t v = 1; v < n; ++v) pares.push_back(Par(v, v + 1));
+            break;
+
+        case Forma::Leque:
+            break; // inicio -> todas -> fim (abaixo)
+
+        case Forma::Camadas: {
+            const auto largura = std::max<uint32_t>(
+                    1, static_cast<uint32_t>(std::sqrt(static_cast<double>(n))));
+            for (uint32_t v = 1 + largura; v <= n; ++v) {
+                // Ao menos uma antecessora na camada anterior
+                const auto camada = (v - 1) / largura;
+                const auto base = 1 + (camada - 1) * largura;
+                pares.push_back(Par(base + static_cast<uint32_t>(rng() % largura), v));
+            }
+            break;
+        }
+
+        case Forma::SerieParalelo:
+            serieParalelo(pares, 1, n + 1, rng);
+            break;
+    }
+
+    // Conexões extras (sempre de um id menor para um maior, sem repetir)
+    std::unordered_set<uint64_t> existentes;
+    for (const auto &p : pares) {
+        existentes.insert((static_cast<uint64_t>(p.first) << 32) | p.second);
+    }
+
+    const auto extras = static_cast<uint64_t>(parametros.densidade * n);
+    for (uint64_t e = 0; e < extras && n > 1; ++e) {
+        auto a = 1 + static_cast<uint32_t>(rng() % n);
+        auto b = 1 + static_cast<uint32_t>(rng() % n);
+        if (a == b) continue;
+        if (a > b) std::swap(a, b);
+        if (existentes.insert((static_cast<uint64_t>(a) << 32) | b).second) {
+            pares.push_back(Par(a, b));
+        }
+    }
+
+    // Toda atividade sem antecessora parte do inicio;
+    // toda atividade sem sucessora chega ao fim
+    std::vector<char> temAnt(n + 2, 0), temSuc(n + 2, 0);
+    for (const auto &p : pares) {
+        temSuc[p.first] = 1;
+        temAnt[p.second] = 1;
+    }
+    for (uint32_t v = 1; v <= n; ++v) {
+        if (!temAnt[v]) pares.push_back(Par(inicio, v));
+        if (!temSuc[v]) pares.push_back(Par(v, fim));
+    }
+
+    // Execução simulada: ids já estão em ordem topológica
+    std::vector<std::vector<uint32_t>> antecessoras(n + 2);
+    for (const auto &p : pares) antecessoras[p.second].push_back(p.first);
+
+    std::vector<int> comeco(n + 2, 1), termino(n + 2, 1);
+    int ultimo = 1;
+    for (uint32_t v = 1; v <= n; ++v) {
+        int c = 1;
+        for (const auto a : antecessoras[v]) c = std::max(c, termino[a]);
+        comeco[v] = c;
+        termino[v] = c + duracao[v] +
+                     static_cast<int>(rng() % (std::max(parametros.atrasoMaximo, 0) + 1));
+        ultimo = std::max(ultimo, termino[v]);
+    }
+
+    const auto dias = parametros.dias ? static_cast<int>(parametros.dias) : ultimo;
+
+    std::vector<std::vector<uint32_t>> iniciadas(dias + 1), finalizadas(dias + 1);
+    for (uint32_t v = 1; v <= n; ++v) {
+        if (comeco[v] <= dias) iniciadas[comeco[v]].push_back(v);
+        if (termino[v] <= dias) finalizadas[termino[v]].push_back(v);
+    }
+
+    // Primeira seção
+    out << "#\n{{inicio,-1}";
+    for (uint32_t v = 1; v <= n; ++v) {
+        out << ",{A" << v << ',';
+        if (parametros.tresPontos) {
+            out << otimista[v] << ',' << duracao[v] << ',' << pessimista[v] << '}';
+        } else {
+            out << duracao[v] << '}';
+        }
+    }
+    out << ",{fim,-1}}\n";
+
+    // Segunda seção
+    out << "#\n";
+    for (const auto &p : pares) {
+        out << '{';
+        if (p.first == inicio) out << "inicio"; else out << 'A' << p.first;
+        out << ',';
+        if (p.second == fim) out << "fim"; else out << 'A' << p.second;
+        out << "}\n";
+    }
+
+    // Terceira seção
+    out << "#\n";
+    for (int d = 1; d <= dias; ++d) {
+        out << d << ": {";
+        if (!iniciadas[d].empty()) {
+            out << "i:";
+            for (size_t i = 0; i < iniciadas[d].size(); ++i) {
+                out << (i ? "," : "") << 'A' << iniciadas[d][i];
+            }
+        }
+        if (!finalizadas[d].empty()) {
+            out << (iniciadas[d].empty() ? "f:" : ";f:");
+            for (size_t i = 0; i < finalizadas[d].size(); ++i) {
+                out << (i ? "," : "") << 'A' << finalizadas[d][i];
+            }
+        }
+        out << "}\n";
+    }
+}
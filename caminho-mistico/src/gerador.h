@@ -0,0 +1,52 @@
+/// Calculador de Caminho Critico
+/// Gerador de projetos sintéticos (arquivos de entrada válidos)
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_GERADOR_H
+#define CAMINHO_MISTICO_GERADOR_H
+
+#include <cstdint>      // uint64_t
+#include <ostream>      // ostream
+#include <string>       // string
+
+/// Forma do grafo de dependências
+enum class Forma {
+    Cadeia,         // A1 -> A2 -> ... -> An
+    Leque,          // inicio -> todas -> fim
+    Camadas,        // ~sqrt(n) camadas ligadas à camada anterior
+    SerieParalelo   // composição série/paralelo (fork/join)
+};
+
+/// Parâmetros do gerador
+struct ParametrosGerador {
+    /// Quantidade de atividades (sem inicio/fim)
+    uint32_t atividades = 100;
+    /// Conexões extras por atividade (média), sempre "para frente"
+    double densidade = 0.0;
+    Forma forma = Forma::Camadas;
+    /// Dias da terceira seção (0: até o fim da execução simulada)
+    uint32_t dias = 0;
+    /// Duração máxima de cada atividade (mínima: 1)
+    int duracaoMaxima = 10;
+    /// Atraso máximo sorteado na execução simulada
+    int atrasoMaximo = 2;
+    uint64_t semente = 1;
+    /// Estimativas de três pontos {nome,otimista,provavel,pessimista}
+    bool tresPontos = false;
+};
+
+/// Converte o nome de uma forma (cadeia, leque, camadas, serie-paralelo)
+/// @return false caso o nome seja inválido
+bool leForma(const std::string &nome, Forma &forma);
+
+/// Escreve um arquivo de entrada completo (três seções)
+/// A terceira seção vem de uma execução simulada com atrasos aleatórios
+/// @param out saída
+/// @param parametros parâmetros do gerador
+void geraProjeto(std::ostream &out, const ParametrosGerador &parametros);
+
+#endif // CAMINHO_MISTICO_GERADOR_H
@@ -0,0 +1,169 @@
+/// Calculador de Caminho Critico
+/// Grafo de dependências: nomes internados, pesos e arestas em CSR
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "grafo.h"
+
+#include <type_traits>  // conditional
+
+#include "instrumentacao.h" // conta
+
+/// Hash FNV-1a de 32 bits
+static uint32_t hashNome(const char *nome, size_t n) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < n; ++i) {
+        h ^= static_cast<unsigned char>(nome[i]);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+size_t Grafo::posicao(const char *nome, size_t n) const {
+    const auto mascara = indice.size() - 1;
+    auto pos = hashNome(nome, n) & mascara;
+
+    while (indice[pos] != ATV_NULA) {
+        const auto &existente = nomes[indice[pos]];
+        if (existente.size() == n && 0 == existente.compare(0, n, nome, n)) {
+            break;
+        }
+        pos = (pos + 1) & mascara;
+    }
+    return pos;
+}
+
+void Grafo::reindexa(size_t capacidade) {
+    indice.assign(capacidade, ATV_NULA);
+    for (AtvId v = 0; v < tamanho(); ++v) {
+        indice[posicao(nomes[v].data(), nomes[v].size())] = v;
+    }
+}
+
+void Grafo::indexa() {
+    // Fator de carga <= 1/2 (capacidade: potência de 2)
+    size_t capacidade = 16;
+    while (capacidade < 2 * nomes.size()) capacidade *= 2;
+    reindexa(capacidade);
+}
+
+void Grafo::reserva(size_t n) {
+    nomes.reserve(n);
+    peso.reserve(n);
+
+    // A mesma capacidade que interna atingiria com n atividades
+    size_t capacidade = 16;
+    while (capacidade < 2 * n) capacidade *= 2;
+    if (capacidade > indice.size()) reindexa(capacidade);
+}
+
+AtvId Grafo::interna(const char *nome, size_t n, int p) {
+    const auto id = tamanho();
+
+    // Fator de carga <= 1/2 (capacidade: potência de 2)
+    if (2 * (nomes.size() + 1) > indice.size()) {
+        reindexa(indice.empty() ? 16 : 2 * indice.size());
+    }
+
+    const auto pos = posicao(nome, n);
+
+    if (indice[pos] != ATV_NULA) {
+        return ATV_NULA;
+    }
+
+    indice[pos] = id;
+    nomes.push_back(std::string(nome, n));
+    peso.push_back(p);
+
+    if (p == -1) {
+        if (inicio == ATV_NULA) {
+            inicio = id;
+        } else if (fim == ATV_NULA) {
+            fim = id;
+        }
+    }
+
+    return id;
+}
+
+AtvId Grafo::busca(const char *nome, size_t n) const {
+    conta(Contador::Buscas);
+    if (indice.empty()) return ATV_NULA;
+    return indice[posicao(nome, n)];
+}
+
+/// Monta uma lista CSR por contagem (estável: mantém a ordem de entrada)
+/// @param inicioCsr deslocamentos de saída (n + 1)
+/// @param vizinhos vizinhos de saída
+/// @param arestas conexões
+/// @param n quantidade de atividades
+/// @param direta true: from -> to (sucessores); false: to -> from
+static void montaCsr(std::vector<uint32_t> &inicioCsr,
+                     std::vector<AtvId> &vizinhos,
+                     const std::vector<Aresta> &arestas,
+                     AtvId n, bool direta) {
+
+    inicioCsr.assign(n + 1, 0);
+    for (const auto &a : arestas) {
+        ++inicioCsr[(direta ? a.first : a.second) + 1];
+    }
+    for (AtvId v = 0; v < n; ++v) {
+        inicioCsr[v + 1] += inicioCsr[v];
+    }
+
+    vizinhos.resize(arestas.size());
+    std::vector<uint32_t> pos(inicioCsr.begin(), inicioCsr.end() - 1);
+    for (const auto &a : arestas) {
+        if (direta) {
+            vizinhos[pos[a.first]++] = a.second;
+        } else {
+            vizinhos[pos[a.second]++] = a.first;
+        }
+    }
+}
+
+void Grafo::montaArestas(const std::vector<Aresta> &arestas,
+                         std::vector<std::pair<size_t, size_t>> *duplicadas) {
+
+    // Remove duplicatas em O(E) mantendo a primeira ocorrência
+    // Tabela por endereçamento aberto (como o índice de nomes): duas
+    // alocações em vez de um nó por conexão; a chave {from, to} tem o dobro
+    // da largura de AtvId (32 bits no perfil compacto)
+    typedef std::conditional<sizeof(AtvId) == sizeof(uint16_t), uint32_t, uint64_t>::type Chave;
+    const auto VAZIA = static_cast<Chave>(~0ull);
+    size_t capacidade = 16;
+    while (capacidade < 2 * arestas.size()) capacidade *= 2;
+    const auto mascara = capacidade - 1;
+
+    std::vector<Chave> chaves(capacidade, VAZIA);
+    std::vector<uint32_t> primeira(capacidade);     // como sucInicio: < 2^32
+    std::vector<Aresta> unicas;
+    unicas.reserve(arestas.size());
+
+    if (duplicadas) duplicadas->clear();
+
+    for (size_t i = 0; i < arestas.size(); ++i) {
+        const auto &a = arestas[i];
+        const auto chave = static_cast<Chave>(
+                (static_cast<Chave>(a.first) << (8 * sizeof(AtvId))) | a.second);
+
+        // Hash multiplicativo (Fibonacci) nos bits altos
+        auto pos = static_cast<size_t>((static_cast<uint64_t>(chave) * 0x9E3779B97F4A7C15ull) >> 32) &
+                   mascara;
+        while (chaves[pos] != VAZIA && chaves[pos] != chave) pos = (pos + 1) & mascara;
+
+        if (chaves[pos] == VAZIA) {
+            chaves[pos] = chave;
+            primeira[pos] = static_cast<uint32_t>(i);
+            unicas.push_back(a);
+        } else if (duplicadas) {
+            duplicadas->push_back(std::make_pair(i, primeira[pos]));
+        }
+    }
+
+    montaCsr(sucInicio, sucessores, unicas, tamanho(), true);
+    montaCsr(antInicio, antecessores, unicas, tamanho(), false);
+}
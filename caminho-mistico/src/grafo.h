@@ -0,0 +1,117 @@
+/// Calculador de Caminho Critico
+/// Grafo de dependências: nomes internados, pesos e arestas em CSR
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_GRAFO_H
+#define CAMINHO_MISTICO_GRAFO_H
+
+#include <cstddef>          // size_t
+#include <cstdint>          // uint16_t, uint32_t
+#include <string>           // string
+#include <utility>          // pair
+#include <vector>           // vector
+
+/// Identificador denso de uma atividade (índice no cabeçalho)
+/// Perfil compacto (CAMINHO_MISTICO_COMPACTO): 16 bits, até 65535
+/// atividades; as posições das listas CSR continuam com 32 bits
+#if defined(CAMINHO_MISTICO_COMPACTO)
+typedef uint16_t AtvId;
+#else
+typedef uint32_t AtvId;
+#endif
+
+/// Identificador inválido (atividade inexistente)
+const AtvId ATV_NULA = static_cast<AtvId>(-1);
+
+/// Maior quantidade de atividades (ids 0..MAX_ATIVIDADES-1)
+const size_t MAX_ATIVIDADES = ATV_NULA;
+
+/// Conexão {from, to}
+typedef std::pair<AtvId, AtvId> Aresta;
+
+/// Estimativa de três pontos (PERT), em dias
+struct TresPontos {
+    int otimista = 0;
+    int provavel = 0;
+    int pessimista = 0;
+};
+
+/// Grafo de dependências
+///     - cada nome é internado uma única vez em um id denso (0..n-1)
+///     - pesos em vetor próprio (estrutura de vetores)
+///     - sucessores e antecessores em CSR (compressed sparse row):
+///       os vizinhos de v estão em [inicio[v], inicio[v + 1])
+struct Grafo {
+    std::vector<std::string> nomes;
+    std::vector<int> peso;
+
+    /// Estimativas de três pontos, indexadas pelo id; vazio caso nenhuma
+    /// atividade use {nome,otimista,provavel,pessimista} (durações fixas
+    /// têm os três pontos iguais ao peso)
+    std::vector<TresPontos> estimativa;
+
+    std::vector<uint32_t> sucInicio;
+    std::vector<AtvId> sucessores;
+    std::vector<uint32_t> antInicio;
+    std::vector<AtvId> antecessores;
+
+    /// "inicio" e "fim" (ou seus equivalentes): extremos com peso -1
+    AtvId inicio = ATV_NULA;
+    AtvId fim = ATV_NULA;
+
+    /// Interna uma atividade do cabeçalho
+    /// @param nome nome da atividade
+    /// @param n tamanho do nome
+    /// @param p peso da atividade
+    /// @return id da atividade ou ATV_NULA caso já exista
+    AtvId interna(const char *nome, size_t n, int p);
+    AtvId interna(const std::string &nome, int p) { return interna(nome.data(), nome.size(), p); }
+
+    /// Reserva nomes, pesos e o índice para n atividades (o cabeçalho é
+    /// contado antes de ser lido: nenhuma realocação durante a leitura)
+    /// @param n quantidade de atividades
+    void reserva(size_t n);
+
+    /// Busca o id de uma atividade pelo nome (O(1), sem alocação)
+    /// @param nome nome da atividade
+    /// @param n tamanho do nome
+    /// @return id da atividade ou ATV_NULA
+    AtvId busca(const char *nome, size_t n) const;
+    AtvId busca(const std::string &nome) const { return busca(nome.data(), nome.size()); }
+
+    /// Monta as listas CSR a partir das conexões
+    /// Conexões duplicadas são descartadas e a ordem do arquivo é mantida
+    /// @param arestas conexões {from, to}
+    /// @param duplicadas índices {duplicata, primeira ocorrência} (opcional)
+    void montaArestas(const std::vector<Aresta> &arestas,
+                      std::vector<std::pair<size_t, size_t>> *duplicadas = nullptr);
+
+    /// Reconstrói o índice de nomes (após preencher nomes/peso diretamente,
+    /// como na leitura do cache binário)
+    void indexa();
+
+    /// Quantidade de atividades
+    AtvId tamanho() const { return static_cast<AtvId>(nomes.size()); }
+
+    /// Quantidade de conexões (sem duplicatas)
+    size_t qtdeArestas() const { return sucessores.size(); }
+
+    const AtvId *sucBegin(AtvId v) const { return sucessores.data() + sucInicio[v]; }
+    const AtvId *sucEnd(AtvId v) const { return sucessores.data() + sucInicio[v + 1]; }
+    const AtvId *antBegin(AtvId v) const { return antecessores.data() + antInicio[v]; }
+    const AtvId *antEnd(AtvId v) const { return antecessores.data() + antInicio[v + 1]; }
+
+private:
+    /// Índice hash por endereçamento aberto (sondagem linear)
+    /// Cada posição guarda um id (ou ATV_NULA); a chave é nomes[id]
+    std::vector<AtvId> indice;
+
+    size_t posicao(const char *nome, size_t n) const;
+    void reindexa(size_t capacidade);
+};
+
+#endif // CAMINHO_MISTICO_GRAFO_H
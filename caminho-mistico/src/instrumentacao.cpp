@@ -0,0 +1,107 @@
+/// Calculador de Caminho Critico
+/// Instrumentação: tempo por etapa, contadores e pico de memória
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "instrumentacao.h"
+
+#include <atomic>       // atomic
+#include <iomanip>      // setprecision
+
+#if !defined (_WIN32)
+#  include <sys/resource.h> // getrusage
+#endif
+
+bool instrumentando = false;
+
+namespace {
+
+typedef std::chrono::steady_clock Relogio;
+
+const char *const NOMES_ETAPAS[] = {
+        "arquivo", "secoes", "dias", "arestas", "validacao", "cache",
+        "cronograma", "caminhos", "criticos", "maiores", "simulacao", "reproducao"};
+
+const char *const NOMES_CONTADORES[] = {
+        "bytes", "atividades", "conexoes", "caminhos", "criticos", "buscas", "dias"};
+
+static_assert(sizeof(NOMES_ETAPAS) / sizeof(*NOMES_ETAPAS) == size_t(Etapa::QTDE),
+              "nome de cada etapa");
+static_assert(sizeof(NOMES_CONTADORES) / sizeof(*NOMES_CONTADORES) == size_t(Contador::QTDE),
+              "nome de cada contador");
+
+/// Medições (relaxed: somente somas, lidas ao final)
+std::atomic<uint64_t> nanossegundos[size_t(Etapa::QTDE)];
+std::atomic<uint64_t> chamadas[size_t(Etapa::QTDE)];
+std::atomic<uint64_t> contagens[size_t(Contador::QTDE)];
+
+Relogio::time_point ligada;
+
+} // namespace
+
+void ligaInstrumentacao() {
+    for (auto &n : nanossegundos) n.store(0, std::memory_order_relaxed);
+    for (auto &n : chamadas) n.store(0, std::memory_order_relaxed);
+    for (auto &n : contagens) n.store(0, std::memory_order_relaxed);
+
+    ligada = Relogio::now();
+    instrumentando = true;
+}
+
+void registraTempo(Etapa etapa, Relogio::time_point inicio) {
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Relogio::now() - inicio).count();
+    nanossegundos[size_t(etapa)].fetch_add(static_cast<uint64_t>(ns), std::memory_order_relaxed);
+    chamadas[size_t(etapa)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void registraContagem(Contador contador, uint64_t n) {
+    contagens[size_t(contador)].fetch_add(n, std::memory_order_relaxed);
+}
+
+long picoMemoria() {
+#if defined (_WIN32)
+    return 0;
+#else
+    struct rusage uso;
+    if (0 != getrusage(RUSAGE_SELF, &uso)) return 0;
+#  if defined (__APPLE__)
+    return uso.ru_maxrss / 1024; // bytes
+#  else
+    return uso.ru_maxrss;        // KiB
+#  endif
+#endif
+}
+
+void printInstrumentacao(std::ostream &out) {
+
+    const auto total = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Relogio::now() - ligada).count();
+
+    const auto flags = out.flags();
+    const auto precisao = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    out << "{\n  \"total_ms\": " << total / 1e6 << ",\n  \"etapas\": {";
+    for (size_t i = 0; i < size_t(Etapa::QTDE); ++i) {
+        out << (0 == i ? "\n" : ",\n")
+            << "    \"" << NOMES_ETAPAS[i] << "\": {\"ms\": "
+            << nanossegundos[i].load(std::memory_order_relaxed) / 1e6
+            << ", \"chamadas\": " << chamadas[i].load(std::memory_order_relaxed) << "}";
+    }
+
+    out << "\n  },\n  \"contadores\": {";
+    for (size_t i = 0; i < size_t(Contador::QTDE); ++i) {
+        out << (0 == i ? "\n" : ",\n")
+            << "    \"" << NOMES_CONTADORES[i] << "\": "
+            << contagens[i].load(std::memory_order_relaxed);
+    }
+
+    out << "\n  },\n  \"pico_memoria_kib\": " << picoMemoria() << "\n}\n";
+
+    out.flags(flags);
+    out.precision(precisao);
+}
@@ -0,0 +1,97 @@
+/// Calculador de Caminho Critico
+/// Instrumentação: tempo por etapa, contadores e pico de memória
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_INSTRUMENTACAO_H
+#define CAMINHO_MISTICO_INSTRUMENTACAO_H
+
+#include <chrono>       // steady_clock
+#include <cstdint>      // uint8_t, uint64_t
+#include <ostream>      // ostream
+
+/// Etapas medidas por Cronometro
+enum class Etapa : uint8_t {
+    Arquivo,        // abertura e verificação do arquivo
+    Secoes,         // leitura do cabeçalho e das conexões
+    Dias,           // leitura da terceira seção
+    Arestas,        // montagem das listas de sucessores/antecessores
+    Validacao,      // extremos, ciclos e atividades fora dos caminhos
+    Cache,          // leitura/gravação do cache binário
+    Cronograma,     // ES/EF/LS/LF estáticos
+    Caminhos,       // listagem CAMINHOS
+    Criticos,       // caminhos críticos
+    Maiores,        // caminhos mais longos
+    Simulacao,      // Monte Carlo
+    Reproducao,     // reprodução dos dias (com o relatório e a espera do ENTER)
+    QTDE
+};
+
+/// Contadores acumulados por conta
+enum class Contador : uint8_t {
+    Bytes,          // bytes lidos do texto
+    Atividades,     // atividades carregadas (com os extremos)
+    Conexoes,       // conexões carregadas (sem duplicatas)
+    Caminhos,       // caminhos listados
+    Criticos,       // caminhos críticos extraídos
+    Buscas,         // buscas de atividades pelo nome
+    Dias,           // dias reproduzidos
+    QTDE
+};
+
+/// Instrumentação ligada (somente alterada antes de iniciar as threads)
+/// Desligada, cada ponto de medição custa um único teste desta variável
+extern bool instrumentando;
+
+/// Liga a instrumentação e zera as medições
+void ligaInstrumentacao();
+
+/// Acumula uma duração (use Cronometro)
+void registraTempo(Etapa etapa, std::chrono::steady_clock::time_point inicio);
+
+/// Acumula uma contagem (use conta)
+void registraContagem(Contador contador, uint64_t n);
+
+/// Acumula uma contagem, se a instrumentação estiver ligada
+inline void conta(Contador contador, uint64_t n = 1) {
+    if (instrumentando) registraContagem(contador, n);
+}
+
+/// Cronômetro com escopo: acumula o tempo da construção à destruição
+/// (chamadas concorrentes, como no portfólio, somam os tempos de cada thread)
+class Cronometro {
+public:
+    explicit Cronometro(Etapa e) : etapa(e), ativo(instrumentando) {
+        if (ativo) inicio = std::chrono::steady_clock::now();
+    }
+
+    ~Cronometro() { para(); }
+
+    /// Encerra a medição antes do fim do escopo
+    void para() {
+        if (ativo) registraTempo(etapa, inicio);
+        ativo = false;
+    }
+
+    Cronometro(const Cronometro &) = delete;
+    Cronometro &operator=(const Cronometro &) = delete;
+
+private:
+    Etapa etapa;
+    bool ativo;
+    std::chrono::steady_clock::time_point inicio;
+};
+
+/// Pico de memória residente do processo (KiB; 0: indisponível)
+long picoMemoria();
+
+/// Escreve o resumo em JSON: tempo total desde ligaInstrumentacao, tempo e
+/// chamadas de cada etapa, contadores e pico de memória (todas as chaves
+/// sempre presentes, para comparar execuções)
+/// @param out saída
+void printInstrumentacao(std::ostream &out);
+
+#endif // CAMINHO_MISTICO_INSTRUMENTACAO_H
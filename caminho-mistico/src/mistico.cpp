@@ -0,0 +1,174 @@
+/// Calculador de Caminho Critico
+/// Biblioteca: cálculo de um projeto com resultado e erro estruturados
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "mistico.h"
+
+#include "arquivo.h"    // ArquivoMapeado
+#include "execucao.h"   // Execucao
+#include "instrumentacao.h" // Cronometro, conta
+#include "paralelo.h"   // Equipe, calculaCPMParalelo
+#include "parser.h"     // Projeto, parseProjeto
+#include "validacao.h"  // Validacao, validaGrafo
+
+namespace {
+
+/// Nomes das atividades, na mesma ordem
+void nomes(std::vector<std::string> &saida, const std::vector<AtvId> &ids, const Grafo &grafo) {
+    for (const auto v : ids) saida.push_back(grafo.nomes[v]);
+}
+
+/// montaProjeto com ou sem equipe (nullptr: leitura e cálculo sequenciais)
+bool monta(Projeto &projeto, Cronograma &cronograma, ErroProjeto &erro,
+           const char *texto, size_t tamanho, Equipe *equipe) {
+
+    erro = ErroProjeto();
+
+    ErroParse erroParse;
+    if (!(nullptr == equipe ? parseProjeto(projeto, texto, tamanho, erroParse)
+                            : parseProjeto(projeto, texto, tamanho, erroParse, *equipe))) {
+        erro.codigo = CodigoErro::Leitura;
+        erro.linha = erroParse.linha;
+        erro.coluna = erroParse.coluna;
+        erro.mensagem = erroParse.mensagem;
+        return false;
+    }
+
+    conta(Contador::Atividades, projeto.grafo.tamanho());
+    conta(Contador::Conexoes, projeto.grafo.qtdeArestas());
+
+    // Estrutura: extremos, ciclos e atividades fora dos caminhos (O(V+E))
+    Validacao validacao;
+
+    Cronometro cronometroValidacao(Etapa::Validacao);
+    if (!validaGrafo(validacao, projeto.grafo)) {
+        erro.codigo = validacao.ciclo.empty() ? CodigoErro::Estrutura : CodigoErro::Ciclo;
+        erro.mensagem = descreveValidacao(validacao, projeto.grafo);
+        nomes(erro.atividades, validacao.ciclo, projeto.grafo);
+        nomes(erro.atividades, validacao.inalcancaveis, projeto.grafo);
+        nomes(erro.atividades, validacao.semSaida, projeto.grafo);
+        return false;
+    }
+    cronometroValidacao.para();
+
+    // Calcula ES/EF/LS/LF (O(V+E)), em paralelo por níveis se pedido
+    bool calculado;
+    Cronometro cronometroCPM(Etapa::Cronograma);
+    if (nullptr == equipe || 1 == equipe->tamanho()) {
+        calculado = calculaCPM(cronograma, projeto.grafo);
+    } else {
+        calculado = calculaCPMParalelo(cronograma, projeto.grafo, *equipe);
+    }
+    cronometroCPM.para();
+
+    if (!calculado) {
+        erro.codigo = CodigoErro::Ciclo;
+        erro.mensagem = "ciclo na secao de conexoes";
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+bool montaProjeto(Projeto &projeto, Cronograma &cronograma, ErroProjeto &erro,
+                  const char *texto, size_t tamanho, unsigned threads) {
+    if (1 == threads) {
+        return monta(projeto, cronograma, erro, texto, tamanho, nullptr);
+    }
+    Equipe equipe(threads);
+    return monta(projeto, cronograma, erro, texto, tamanho, &equipe);
+}
+
+bool montaProjeto(Projeto &projeto, Cronograma &cronograma, ErroProjeto &erro,
+                  const char *texto, size_t tamanho, Equipe &equipe) {
+    return monta(projeto, cronograma, erro, texto, tamanho, &equipe);
+}
+
+bool calculaProjeto(ProjetoCalculado &resultado, ErroProjeto &erro,
+                    const char *texto, size_t tamanho,
+                    const ParametrosCalculo &parametros) {
+
+    resultado = ProjetoCalculado();
+    conta(Contador::Bytes, tamanho);
+
+    Projeto projeto;
+    Cronograma cronograma;
+
+    if (!(nullptr != parametros.equipe
+          ? montaProjeto(projeto, cronograma, erro, texto, tamanho, *parametros.equipe)
+          : montaProjeto(projeto, cronograma, erro, texto, tamanho, parametros.threads))) {
+        return false;
+    }
+
+    const auto &grafo = projeto.grafo;
+
+    Execucao execucao;
+    execucao.inicializa(grafo, cronograma);
+
+    if (parametros.reproduzDias) {
+        Cronometro cronometro(Etapa::Reproducao);
+        for (const auto &d : projeto.dias) execucao.processaDia(d, nullptr);
+        resultado.dias = projeto.dias.size();
+    }
+
+    const auto &dinamico = execucao.escalonador();
+
+    resultado.duracaoCritica = cronograma.duracao;
+    resultado.duracaoPrevista = dinamico.duracao();
+    resultado.ultimoDia = execucao.dia();
+
+    std::vector<AtvId> atrasadas;
+    execucao.atrasadas(atrasadas);
+    std::vector<char> atrasada(grafo.tamanho(), 0);
+    for (const auto v : atrasadas) atrasada[v] = 1;
+
+    resultado.atividades.reserve(execucao.atividades().size());
+    for (const auto v : execucao.atividades()) {
+        AtividadeCalculada atividade;
+        atividade.nome = grafo.nomes[v];
+        atividade.estatico = cronograma.atividade(grafo, v);
+        atividade.previsto = dinamico.atividade(v);
+        atividade.atrasada = 0 != atrasada[v];
+        resultado.atividades.push_back(atividade);
+    }
+
+    // Caminhos críticos: contados sem enumerar, extraídos até o limite
+    Cronometro cronometro(Etapa::Criticos);
+    CaminhosCriticos criticos(grafo, cronograma);
+    resultado.qtdeCriticos = criticos.quantidade();
+
+    std::vector<AtvId> caminho;
+    while (resultado.criticos.size() < parametros.limiteCriticos && criticos.proximo(caminho)) {
+        resultado.criticos.push_back(std::vector<std::string>());
+        nomes(resultado.criticos.back(), caminho, grafo);
+    }
+
+    return true;
+}
+
+bool calculaArquivo(ProjetoCalculado &resultado, ErroProjeto &erro,
+                    const std::string &arquivo,
+                    const ParametrosCalculo &parametros) {
+
+    ArquivoMapeado texto;
+
+    erro = ErroProjeto();
+    if (!texto.abre(arquivo, erro.mensagem)) {
+        erro.codigo = CodigoErro::Arquivo;
+        return false;
+    }
+
+    return calculaProjeto(resultado, erro, texto.dados(), texto.tamanho(), parametros);
+}
+
+std::string descreveErro(const ErroProjeto &erro) {
+    if (erro.linha <= 0) return erro.mensagem;
+    return "linha " + std::to_string(erro.linha) + ", coluna " +
+           std::to_string(erro.coluna) + ": " + erro.mensagem;
+}
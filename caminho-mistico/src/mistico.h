@@ -0,0 +1,136 @@
+/// Calculador de Caminho Critico
+/// Biblioteca: cálculo de um projeto com resultado e erro estruturados
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_MISTICO_H
+#define CAMINHO_MISTICO_MISTICO_H
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint8_t, uint64_t
+#include <string>       // string
+#include <vector>       // vector
+
+#include "cpm.h"        // Cronograma, Estatisticas
+
+struct Projeto;
+class Equipe;
+
+/// Categoria de um erro
+enum class CodigoErro : uint8_t {
+    Nenhum = 0,
+    Arquivo,        // arquivo inexistente, ilegível ou não regular
+    Leitura,        // texto fora do formato (linha e coluna preenchidas)
+    Estrutura,      // sem extremos, atividades sem caminho a partir do inicio/até o fim
+    Ciclo           // ciclo na seção de conexões
+};
+
+/// Erro de um cálculo (nada é escrito na saída nem encerra o processo)
+struct ErroProjeto {
+    CodigoErro codigo = CodigoErro::Nenhum;
+    /// Posição no texto (0: não se aplica)
+    int linha = 0;
+    int coluna = 0;
+    /// Descrição, sem a posição
+    std::string mensagem;
+    /// Atividades envolvidas (ciclo, inalcançáveis e sem saída)
+    std::vector<std::string> atividades;
+};
+
+/// Parâmetros de calculaProjeto
+struct ParametrosCalculo {
+    /// Reproduz os dias da terceira seção (false: somente o cronograma estático)
+    bool reproduzDias = true;
+    /// Máximo de caminhos críticos extraídos (0: nenhum)
+    size_t limiteCriticos = 1;
+    /// Threads da leitura dos dias e do cálculo do cronograma (1: sequencial;
+    /// 0: núcleos disponíveis), criadas e encerradas em cada chamada
+    unsigned threads = 1;
+    /// Equipe do chamador, reaproveitada entre as chamadas (substitui
+    /// threads; uma chamada por vez em cada equipe)
+    Equipe *equipe = nullptr;
+};
+
+/// Resultado de uma atividade (sem os extremos)
+struct AtividadeCalculada {
+    std::string nome;
+    /// Cronograma estático
+    Estatisticas estatico;
+    /// Previsão após os dias reproduzidos
+    Estatisticas previsto;
+    /// Iniciada/finalizada depois do LS/LF, ou que os ultrapassou
+    bool atrasada = false;
+};
+
+/// Resultado de um projeto
+struct ProjetoCalculado {
+    int duracaoCritica = 0;
+    int duracaoPrevista = 0;
+    /// Dias reproduzidos e o último deles (0: nenhum)
+    size_t dias = 0;
+    int ultimoDia = 0;
+    /// Em ordem alfabética
+    std::vector<AtividadeCalculada> atividades;
+    /// Quantidade de caminhos críticos (saturada em UINT64_MAX) e os
+    /// primeiros, até ParametrosCalculo::limiteCriticos
+    uint64_t qtdeCriticos = 0;
+    std::vector<std::vector<std::string>> criticos;
+};
+
+/// Calcula um projeto a partir do texto do arquivo de entrada
+/// Reentrante: todo o estado pertence à chamada, sem saída e sem encerrar o
+/// processo; pode ser chamada em paralelo e quantas vezes for preciso
+/// @param resultado resultado de saída
+/// @param erro erro de saída (caso retorne false)
+/// @param texto conteúdo do arquivo (três seções)
+/// @param tamanho tamanho do texto
+/// @param parametros parâmetros do cálculo
+/// @return false em caso de erro
+bool calculaProjeto(ProjetoCalculado &resultado, ErroProjeto &erro,
+                    const char *texto, size_t tamanho,
+                    const ParametrosCalculo &parametros = ParametrosCalculo());
+
+/// Idem, a partir de uma string
+inline bool calculaProjeto(ProjetoCalculado &resultado, ErroProjeto &erro,
+                           const std::string &texto,
+                           const ParametrosCalculo &parametros = ParametrosCalculo()) {
+    return calculaProjeto(resultado, erro, texto.data(), texto.size(), parametros);
+}
+
+/// Calcula um projeto a partir de um arquivo (mapeado em memória)
+/// @param resultado resultado de saída
+/// @param erro erro de saída (caso retorne false)
+/// @param arquivo caminho do arquivo
+/// @param parametros parâmetros do cálculo
+/// @return false em caso de erro
+bool calculaArquivo(ProjetoCalculado &resultado, ErroProjeto &erro,
+                    const std::string &arquivo,
+                    const ParametrosCalculo &parametros = ParametrosCalculo());
+
+/// Lê e valida o projeto e calcula o cronograma estático (etapa comum a
+/// calculaProjeto e ao relatório)
+/// @param projeto projeto de saída
+/// @param cronograma cronograma estático de saída
+/// @param erro erro de saída (caso retorne false)
+/// @param texto conteúdo do arquivo
+/// @param tamanho tamanho do texto
+/// @param threads threads da leitura dos dias e do cálculo do cronograma
+///        (1: sequencial; as demais são criadas e encerradas na chamada)
+/// @return false em caso de erro
+bool montaProjeto(Projeto &projeto, Cronograma &cronograma, ErroProjeto &erro,
+                  const char *texto, size_t tamanho, unsigned threads);
+
+/// Como montaProjeto, com as threads de uma equipe do chamador (reaproveitada
+/// entre as chamadas)
+bool montaProjeto(Projeto &projeto, Cronograma &cronograma, ErroProjeto &erro,
+                  const char *texto, size_t tamanho, Equipe &equipe);
+
+/// Descreve um erro em uma linha ("linha L, coluna C: mensagem")
+/// @param erro erro
+/// @return descrição
+std::string descreveErro(const ErroProjeto &erro);
+
+#endif // CAMINHO_MISTICO_MISTICO_H
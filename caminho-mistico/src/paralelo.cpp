@@ -0,0 +1,239 @@
+/// Calculador de Caminho Critico
+/// Cálculo do cronograma em paralelo, por níveis topológicos
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "paralelo.h"
+
+#include <algorithm>    // max, min
+#include <atomic>       // atomic
+#include <memory>       // unique_ptr
+
+namespace {
+
+/// Intervalos menores são executados somente pela thread chamadora
+/// (acordar as threads custa mais do que o trabalho)
+const size_t MIN_PARALELO = 2048;
+
+/// Percorre os níveis (em ordem ou invertidos), cada nível em paralelo
+/// @param ordem atividades agrupadas por nível
+/// @param nivel início de cada nível em ordem (níveis + 1)
+/// @param reverso true: do último nível para o primeiro
+/// @param passo processa uma atividade
+template<typename F>
+void percorreNiveis(Equipe &equipe, const std::vector<AtvId> &ordem,
+                    const std::vector<size_t> &nivel, bool reverso, const F &passo) {
+    const auto niveis = nivel.size() - 1;
+    for (size_t k = 0; k < niveis; ++k) {
+        const auto i = reverso ? niveis - 1 - k : k;
+        const auto base = nivel[i];
+        equipe.divide(nivel[i + 1] - base, [&](size_t de, size_t ate, unsigned) {
+            for (auto j = base + de; j < base + ate; ++j) passo(ordem[j]);
+        });
+    }
+}
+
+} // namespace
+
+Equipe::Equipe(unsigned qtde) {
+    if (0 == qtde) {
+        qtde = std::thread::hardware_concurrency();
+        if (0 == qtde) qtde = 1;
+    }
+    qtde = std::min(qtde, MAX_THREADS);
+    for (unsigned t = 1; t < qtde; ++t) {
+        threads.push_back(std::thread(&Equipe::trabalha, this, t));
+    }
+}
+
+Equipe::~Equipe() {
+    {
+        std::lock_guard<std::mutex> lock(trava);
+        encerra = true;
+    }
+    temTrabalho.notify_all();
+    for (auto &t : threads) {
+        t.join();
+    }
+}
+
+void Equipe::divide(size_t n, const Tarefa &tarefa) {
+
+    const auto qtde = tamanho();
+
+    if (1 == qtde || n < MIN_PARALELO) {
+        tarefa(0, n, 0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(trava);
+        atual = &tarefa;
+        total = n;
+        pendentes = qtde - 1;
+        ++geracao;
+    }
+    temTrabalho.notify_all();
+
+    tarefa(0, n / qtde, 0);
+
+    std::unique_lock<std::mutex> lock(trava);
+    terminou.wait(lock, [this]() { return 0 == pendentes; });
+    atual = nullptr;
+}
+
+void Equipe::trabalha(unsigned t) {
+
+    uint64_t vista = 0;
+
+    while (true) {
+        const Tarefa *tarefa;
+        size_t n;
+        {
+            std::unique_lock<std::mutex> lock(trava);
+            temTrabalho.wait(lock, [&]() { return encerra || geracao != vista; });
+            if (encerra) return;
+            vista = geracao;
+            tarefa = atual;
+            n = total;
+        }
+
+        const auto qtde = tamanho();
+        (*tarefa)(n * t / qtde, n * (t + 1) / qtde, t);
+
+        std::lock_guard<std::mutex> lock(trava);
+        if (0 == --pendentes) terminou.notify_one();
+    }
+}
+
+bool calculaCPMParalelo(Cronograma &cronograma, const Grafo &grafo, Equipe &equipe) {
+
+    const auto n = grafo.tamanho();
+    const auto qtde = equipe.tamanho();
+
+    cronograma.inicializa(n);
+
+    // Ordenação topológica por níveis: ordem[nivel[k], nivel[k + 1])
+    std::unique_ptr<std::atomic<uint32_t>[]> grau(new std::atomic<uint32_t>[n]);
+    std::vector<std::vector<AtvId>> proximos(qtde);
+    std::vector<AtvId> ordem;
+    std::vector<size_t> nivel(1, 0);
+    ordem.reserve(n);
+
+    auto junta = [&]() {
+        for (auto &p : proximos) {
+            ordem.insert(ordem.end(), p.begin(), p.end());
+            p.clear();
+        }
+        nivel.push_back(ordem.size());
+    };
+
+    equipe.divide(n, [&](size_t de, size_t ate, unsigned t) {
+        for (auto v = static_cast<AtvId>(de); v < ate; ++v) {
+            const auto g = grafo.antInicio[v + 1] - grafo.antInicio[v];
+            grau[v].store(g, std::memory_order_relaxed);
+            if (0 == g) proximos[t].push_back(v);
+        }
+    });
+    junta();
+
+    while (nivel[nivel.size() - 2] != nivel.back()) {
+        const auto base = nivel[nivel.size() - 2];
+        equipe.divide(nivel.back() - base, [&](size_t de, size_t ate, unsigned t) {
+            for (auto i = base + de; i < base + ate; ++i) {
+                const auto v = ordem[i];
+                for (auto s = grafo.sucBegin(v); s != grafo.sucEnd(v); ++s) {
+                    if (1 == grau[*s].fetch_sub(1, std::memory_order_acq_rel)) {
+                        proximos[t].push_back(*s);
+                    }
+                }
+            }
+        });
+        junta();
+    }
+    nivel.pop_back(); // último nível: vazio
+
+    if (ordem.size() != n) {
+        return false; // ciclo
+    }
+
+    if (grafo.inicio == ATV_NULA || grafo.fim == ATV_NULA) {
+        return true;
+    }
+
+    // Peso efetivo: extremos (-1) não contam
+    auto w = [&grafo](AtvId v) { return grafo.peso[v] > 0 ? grafo.peso[v] : 0; };
+
+    // Atividades em algum caminho inicio -> fim (ver marcaCaminhos)
+    std::vector<char> alcancavel(n, 0);
+    std::vector<char> chegaAoFim(n, 0);
+
+    percorreNiveis(equipe, ordem, nivel, false, [&](AtvId v) {
+        char r = (v == grafo.inicio);
+        for (auto a = grafo.antBegin(v); !r && a != grafo.antEnd(v); ++a) {
+            r = alcancavel[*a] && *a != grafo.fim;
+        }
+        alcancavel[v] = r;
+    });
+
+    percorreNiveis(equipe, ordem, nivel, true, [&](AtvId v) {
+        char r = (v == grafo.fim);
+        if (!r) {
+            for (auto s = grafo.sucBegin(v); !r && s != grafo.sucEnd(v); ++s) {
+                r = chegaAoFim[*s];
+            }
+        }
+        chegaAoFim[v] = r;
+    });
+
+    auto noCaminho = [&](AtvId v) { return alcancavel[v] && chegaAoFim[v]; };
+
+    auto &es = cronograma.earlyStart;
+    auto &ef = cronograma.earlyFinish;
+    auto &ls = cronograma.lateStart;
+    auto &lf = cronograma.lateFinish;
+
+    // Passagem de ida: ES = maior EF das antecessoras (1: primeiro dia)
+    percorreNiveis(equipe, ordem, nivel, false, [&](AtvId v) {
+        if (!noCaminho(v)) return;
+
+        int maior = 1;
+        if (v != grafo.inicio) {
+            for (auto a = grafo.antBegin(v); a != grafo.antEnd(v); ++a) {
+                if (noCaminho(*a) && *a != grafo.fim) {
+                    maior = std::max(maior, ef[*a]);
+                }
+            }
+        }
+
+        es[v] = maior;
+        ef[v] = maior + w(v);
+    });
+
+    const auto duracao = es[grafo.fim] - 1;
+    cronograma.duracao = duracao;
+
+    // Passagem de volta: "cauda" = maior peso da atividade até o fim
+    std::vector<int> cauda(n, 0);
+
+    percorreNiveis(equipe, ordem, nivel, true, [&](AtvId v) {
+        if (!noCaminho(v)) return;
+
+        int maior = 0;
+        if (v != grafo.fim) {
+            for (auto s = grafo.sucBegin(v); s != grafo.sucEnd(v); ++s) {
+                if (noCaminho(*s)) maior = std::max(maior, cauda[*s]);
+            }
+        }
+        cauda[v] = w(v) + maior;
+
+        ls[v] = duracao + 1 - cauda[v];
+        lf[v] = ls[v] + w(v);
+        cronograma.slack[v] = ls[v] - es[v];
+    });
+
+    return true;
+}
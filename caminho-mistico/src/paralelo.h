@@ -0,0 +1,81 @@
+/// Calculador de Caminho Critico
+/// Cálculo do cronograma em paralelo, por níveis topológicos
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_PARALELO_H
+#define CAMINHO_MISTICO_PARALELO_H
+
+#include <condition_variable> // condition_variable
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+#include <functional>   // function
+#include <mutex>        // mutex
+#include <thread>       // thread
+#include <vector>       // vector
+
+#include "cpm.h"        // Cronograma
+#include "grafo.h"      // Grafo
+
+/// Maior quantidade de threads de uma equipe (pedidos maiores são limitados)
+const unsigned MAX_THREADS = 256;
+
+/// Conjunto fixo de threads para laços paralelos (fork/join)
+///
+/// As threads ficam bloqueadas entre as chamadas; cada chamada de divide
+/// reparte um intervalo em blocos contíguos, um por thread, e a thread
+/// chamadora executa o primeiro bloco
+class Equipe {
+public:
+    /// Tarefa sobre o bloco [de, ate) executada pela thread t
+    typedef std::function<void(size_t de, size_t ate, unsigned t)> Tarefa;
+
+    /// @param threads quantidade de threads (0: núcleos disponíveis; no
+    ///        máximo MAX_THREADS)
+    explicit Equipe(unsigned threads);
+    ~Equipe();
+
+    Equipe(const Equipe &) = delete;
+    Equipe &operator=(const Equipe &) = delete;
+
+    /// Quantidade de threads (inclusive a chamadora)
+    unsigned tamanho() const { return static_cast<unsigned>(threads.size()) + 1; }
+
+    /// Executa a tarefa sobre [0, n) e aguarda todos os blocos
+    /// Intervalos pequenos são executados somente pela thread chamadora
+    /// @param n tamanho do intervalo
+    /// @param tarefa tarefa de cada bloco
+    void divide(size_t n, const Tarefa &tarefa);
+
+private:
+    void trabalha(unsigned t);
+
+    std::vector<std::thread> threads;
+    std::mutex trava;
+    std::condition_variable temTrabalho;
+    std::condition_variable terminou;
+
+    const Tarefa *atual = nullptr;
+    size_t total = 0;
+    uint64_t geracao = 0;
+    unsigned pendentes = 0;
+    bool encerra = false;
+};
+
+/// Calcula ES, EF, LS, LF e slack como calculaCPM, em paralelo
+///     - ordenação topológica por níveis (Kahn com graus atômicos): as
+///       atividades de um nível dependem somente de níveis anteriores
+///     - cada passagem (marcação dos caminhos, ida e volta) percorre os
+///       níveis em sequência e as atividades de um nível em paralelo,
+///       cada uma lendo as antecessoras/sucessoras (sem escrita concorrente)
+/// O resultado é idêntico ao de calculaCPM
+/// @param cronograma estatísticas calculadas
+/// @param grafo grafo de dependências
+/// @param equipe threads de trabalho
+/// @return false caso o grafo contenha um ciclo
+bool calculaCPMParalelo(Cronograma &cronograma, const Grafo &grafo, Equipe &equipe);
+
+#endif // CAMINHO_MISTICO_PARALELO_H
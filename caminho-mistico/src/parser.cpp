@@ -0,0 +1,636 @@
+/// Calculador de Caminho Critico
+/// Leitura do arquivo de entrada (três seções) em uma única passagem
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "parser.h"
+
+#include <algorithm>    // count, min
+#include <climits>      // INT_MAX
+#include <cstring>      // memchr
+
+#include "arquivo.h"    // ArquivoMapeado
+#include "instrumentacao.h" // Cronometro
+#include "paralelo.h"   // Equipe
+
+namespace {
+
+/// Leitor de linhas sobre o buffer do arquivo
+/// As linhas são visões do próprio buffer; somente linhas com espaços
+/// são compactadas (espaços removidos) em um buffer reaproveitado
+class Leitor {
+public:
+    Leitor(const char *dados, size_t tamanho, int linhaAnterior = 0)
+            : numero(linhaAnterior), atual(dados), fim(dados + tamanho) {}
+
+    /// Avança para a próxima linha
+    /// @return false ao final do arquivo
+    bool proxima() {
+        if (atual >= fim) return false;
+
+        const auto quebra = static_cast<const char *>(
+                std::memchr(atual, '\n', static_cast<size_t>(fim - atual)));
+        const char *final = quebra ? quebra : fim;
+
+        p = atual;
+        n = static_cast<size_t>(final - atual);
+        atual = quebra ? quebra + 1 : fim;
+        ++numero;
+
+        if (n > 0 && '\r' == p[n - 1]) --n;
+
+        // Remove espaços
+        compactada = (nullptr != std::memchr(p, ' ', n));
+        if (compactada) {
+            linhaCompacta.clear();
+            colunas.clear();
+            for (size_t i = 0; i < n; ++i) {
+                if (' ' == p[i]) continue;
+                linhaCompacta.push_back(p[i]);
+                colunas.push_back(static_cast<uint32_t>(i));
+            }
+            p = linhaCompacta.data();
+            n = linhaCompacta.size();
+        }
+
+        return true;
+    }
+
+    /// Coluna no arquivo (a partir de 1) de uma posição da linha
+    int coluna(size_t pos) const {
+        if (!compactada) return static_cast<int>(pos) + 1;
+        if (pos < colunas.size()) return static_cast<int>(colunas[pos]) + 1;
+        return colunas.empty() ? 1 : static_cast<int>(colunas.back()) + 2;
+    }
+
+    /// Procura um caractere a partir de uma posição da linha
+    size_t procura(char c, size_t de = 0) const {
+        if (de >= n) return npos;
+        const auto r = static_cast<const char *>(std::memchr(p + de, c, n - de));
+        return r ? static_cast<size_t>(r - p) : npos;
+    }
+
+    /// Procura uma sequência de 2 caracteres na linha
+    size_t procuraPar(char a, char b) const {
+        for (size_t i = 0; i + 1 < n; ++i) {
+            if (a == p[i] && b == p[i + 1]) return i;
+        }
+        return npos;
+    }
+
+    /// Início da próxima linha no buffer
+    const char *restante() const { return atual; }
+
+    static const size_t npos = static_cast<size_t>(-1);
+
+    const char *p = nullptr;
+    size_t n = 0;
+    int numero = 0;
+
+private:
+    const char *atual;
+    const char *fim;
+    bool compactada = false;
+    std::string linhaCompacta;
+    std::vector<uint32_t> colunas;
+};
+
+/// Preenche o erro e retorna false
+bool falha(ErroParse &erro, const Leitor &l, size_t pos, const std::string &msg) {
+    erro.linha = l.numero;
+    erro.coluna = l.coluna(pos);
+    erro.mensagem = msg;
+    return false;
+}
+
+/// Converte um trecho em inteiro (com sinal opcional)
+/// @return false caso não seja um inteiro válido
+bool leInteiro(const char *p, size_t n, int &valor) {
+    if (0 == n) return false;
+
+    bool negativo = false;
+    size_t i = 0;
+
+    if ('-' == p[0] || '+' == p[0]) {
+        negativo = ('-' == p[0]);
+        if (1 == n) return false;
+        ++i;
+    }
+
+    long long v = 0;
+    for (; i < n; ++i) {
+        if (p[i] < '0' || p[i] > '9') return false;
+        v = 10 * v + (p[i] - '0');
+        if (v > INT_MAX) return false;
+    }
+
+    valor = static_cast<int>(negativo ? -v : v);
+    return true;
+}
+
+/// Extrai a duração: "peso" ou "otimista,provavel,pessimista" (PERT)
+/// @param estimativa três pontos (iguais ao peso caso seja uma duração fixa)
+/// @param tresPontos true caso seja uma estimativa de três pontos
+bool parseDuracao(const Leitor &l, size_t de, size_t ate, int &peso,
+                  TresPontos &estimativa, bool &tresPontos, ErroParse &erro) {
+
+    const auto v1 = l.procura(',', de);
+    tresPontos = (Leitor::npos != v1 && v1 < ate);
+
+    if (!tresPontos) {
+        if (!leInteiro(l.p + de, ate - de, peso)) {
+            return falha(erro, l, de, "duracao invalida");
+        }
+        estimativa.otimista = estimativa.provavel = estimativa.pessimista = peso;
+        return true;
+    }
+
+    const auto v2 = l.procura(',', v1 + 1);
+    const auto v3 = (Leitor::npos == v2) ? Leitor::npos : l.procura(',', v2 + 1);
+
+    if (Leitor::npos == v2 || v2 >= ate || (Leitor::npos != v3 && v3 < ate) ||
+        !leInteiro(l.p + de, v1 - de, estimativa.otimista) ||
+        !leInteiro(l.p + v1 + 1, v2 - v1 - 1, estimativa.provavel) ||
+        !leInteiro(l.p + v2 + 1, ate - v2 - 1, estimativa.pessimista)) {
+        return falha(erro, l, de, "estimativa de tres pontos invalida");
+    }
+
+    if (estimativa.otimista < 0 || estimativa.otimista > estimativa.provavel ||
+        estimativa.provavel > estimativa.pessimista) {
+        return falha(erro, l, de, "estimativa fora de ordem (otimista <= provavel <= pessimista)");
+    }
+
+    // Duração determinística: média PERT (o + 4m + p) / 6, arredondada
+    const auto soma = static_cast<long long>(estimativa.otimista) +
+                      4LL * estimativa.provavel + estimativa.pessimista;
+    peso = static_cast<int>((soma + 3) / 6);
+    return true;
+}
+
+/// Extrai o cabeçalho: {{nome,peso},{nome,peso},...}
+/// A duração também pode ser uma estimativa de três pontos:
+/// {nome,otimista,provavel,pessimista}
+bool parseCabecalho(Grafo &grafo, const Leitor &l, ErroParse &erro) {
+
+    // Remove o primeiro '{' e o ultimo '}'
+    size_t pos = 1;
+    const size_t final = l.n - 1;
+
+    // Uma atividade por '{' (exceto o primeiro): tabelas com a capacidade final
+    const auto qtdeAtividades = static_cast<size_t>(std::count(l.p + 1, l.p + final, '{'));
+    if (qtdeAtividades > MAX_ATIVIDADES) {
+        return falha(erro, l, 0, "cabecalho com mais de " + std::to_string(MAX_ATIVIDADES) +
+                                 " atividades");
+    }
+    grafo.reserva(qtdeAtividades);
+
+    std::vector<TresPontos> estimativas;
+    estimativas.reserve(qtdeAtividades);
+    bool algumaTresPontos = false;
+
+    while (pos < final) {
+        if ('{' != l.p[pos]) {
+            return falha(erro, l, pos, "cabecalho invalido");
+        }
+
+        const auto virgula = l.procura(',', pos + 1);
+        const auto fecha = l.procura('}', pos + 1);
+
+        if (Leitor::npos == virgula || Leitor::npos == fecha || fecha > final ||
+            virgula > fecha || virgula == pos + 1) {
+            return falha(erro, l, pos, "cabecalho invalido");
+        }
+
+        int peso = 0;
+        TresPontos estimativa;
+        bool tresPontos = false;
+        if (!parseDuracao(l, virgula + 1, fecha, peso, estimativa, tresPontos, erro)) {
+            return false;
+        }
+        estimativas.push_back(estimativa);
+        algumaTresPontos = algumaTresPontos || tresPontos;
+
+        // Verifica se o grafo ja contem a atividade
+        const auto nome = l.p + pos + 1;
+        const auto tam = virgula - pos - 1;
+
+        if (ATV_NULA == grafo.interna(nome, tam, peso)) {
+            return falha(erro, l, pos + 1,
+                         "atividade \"" + std::string(nome, tam) + "\" duplicada");
+        }
+
+        pos = fecha + 1;
+        if (pos < final) {
+            if (',' != l.p[pos]) {
+                return falha(erro, l, pos, "cabecalho invalido");
+            }
+            ++pos;
+        }
+    }
+
+    int qtde = 0;
+
+    for (const auto p : grafo.peso) {
+        if (p == -1) qtde++;
+    }
+
+    if (qtde > 2) {
+        return falha(erro, l, 0, "cabecalho com mais de 2 extremos");
+    }
+
+    // Estimativas somente se alguma atividade usar três pontos
+    // (extremos: duração nula)
+    if (algumaTresPontos) {
+        for (AtvId v = 0; v < grafo.tamanho(); ++v) {
+            if (grafo.peso[v] == -1) estimativas[v] = TresPontos();
+        }
+        grafo.estimativa.swap(estimativas);
+    }
+
+    return true;
+}
+
+/// Extrai uma ligação: {from,to}
+bool parsePar(std::vector<Aresta> &pares, const Grafo &grafo,
+              const Leitor &l, ErroParse &erro) {
+
+    if ('}' != l.p[l.n - 1]) {
+        return falha(erro, l, l.n - 1, "codificacao invalida");
+    }
+
+    const auto virgula = l.procura(',');
+
+    if (Leitor::npos == virgula || Leitor::npos != l.procura(',', virgula + 1)) {
+        return falha(erro, l, 0, "codificacao invalida");
+    }
+
+    // Verifica se a atividade esta no cabeçalho
+    const auto from = grafo.busca(l.p + 1, virgula - 1);
+    if (ATV_NULA == from) {
+        return falha(erro, l, 1,
+                     "\"" + std::string(l.p + 1, virgula - 1) + "\" "
+                             "nao especificada no cabecalho");
+    }
+
+    const auto tamTo = l.n - virgula - 2;
+    const auto to = grafo.busca(l.p + virgula + 1, tamTo);
+    if (ATV_NULA == to) {
+        return falha(erro, l, virgula + 1,
+                     "\"" + std::string(l.p + virgula + 1, tamTo) + "\" "
+                             "nao especificada no cabecalho");
+    }
+
+    pares.push_back(std::make_pair(from, to));
+    return true;
+}
+
+/// Extrai uma lista de atividades separadas por vírgula: [de, ate)
+/// Os ids são reunidos em um vetor reaproveitado e copiados para a arena
+bool parseLista(ListaAtv &lista, Arena &memoria, std::vector<AtvId> &ids,
+                const Grafo &grafo, const Leitor &l, size_t de, size_t ate,
+                ErroParse &erro) {
+
+    ids.clear();
+
+    while (true) {
+        auto virgula = l.procura(',', de);
+        if (Leitor::npos == virgula || virgula > ate) virgula = ate;
+
+        const auto id = grafo.busca(l.p + de, virgula - de);
+
+        if (ATV_NULA == id) {
+            return falha(erro, l, de,
+                         "atividade \"" + std::string(l.p + de, virgula - de) +
+                         "\" nao especificada no cabecalho");
+        }
+
+        ids.push_back(id);
+
+        if (virgula >= ate) break;
+        de = virgula + 1;
+    }
+
+    lista.dados = memoria.copia(ids.data(), ids.size());
+    lista.n = static_cast<uint32_t>(ids.size());
+    return true;
+}
+
+/// Extrai a execução de um dia: dia:{i:atvA,atvB;f:atvC}
+/// @param valido false caso a linha seja ignorada (comentários)
+/// @param ids vetor temporário (reaproveitado entre as linhas)
+bool parseDia(Day &thisDay, bool &valido, Arena &memoria, std::vector<AtvId> &ids,
+              const Grafo &grafo, const Leitor &l, ErroParse &erro) {
+
+    valido = false;
+
+    // Índice do dia
+    size_t it = 0;
+    while (it < l.n && ':' != l.p[it] && '{' != l.p[it]) ++it;
+
+    if (it == l.n || 0 == it) {
+        return falha(erro, l, it, "linha \'execucao\' invalida");
+    }
+
+    // Extrai o índice (caso não seja um número: comentário)
+    for (size_t i = 0; i < it; ++i) {
+        if (l.p[i] < '0' || l.p[i] > '9') return true;
+    }
+
+    if (!leInteiro(l.p, it, thisDay.dia)) {
+        return falha(erro, l, 0, "dia invalido");
+    }
+
+    // Busca por atividades iniciadas e finalizadas no dia
+    const auto temInicio_it = l.procuraPar('i', ':');
+    const auto temFinal_it = l.procuraPar('f', ':');
+
+    size_t final = l.n;
+
+    if (Leitor::npos != temFinal_it) {
+        // Extrai as atividades finalizadas (remove '}')
+        if (temFinal_it + 3 > l.n) {
+            return falha(erro, l, temFinal_it, "linha \'execucao\' invalida");
+        }
+        if (!parseLista(thisDay.finalizadas, memoria, ids, grafo, l,
+                        temFinal_it + 2, l.n - 1, erro)) {
+            return false;
+        }
+        final = temFinal_it;
+    }
+
+    if (Leitor::npos != temInicio_it) {
+        // Extrai as atividades iniciadas (remove '}' ou ';')
+        if (temInicio_it + 3 > final) {
+            return falha(erro, l, temInicio_it, "linha \'execucao\' invalida");
+        }
+        if (!parseLista(thisDay.iniciadas, memoria, ids, grafo, l,
+                        temInicio_it + 2, final - 1, erro)) {
+            return false;
+        }
+    }
+
+    valido = true;
+    return true;
+}
+
+/// Extrai os dias de um trecho formado por linhas completas
+/// @param quebras quantidade de '\n' do trecho (numeração dos trechos seguintes)
+bool parseTrecho(std::vector<struct Day> &dias, Arena &memoria, const Grafo &grafo,
+                 const char *dados, size_t tamanho, int linhaAnterior,
+                 size_t &quebras, ErroParse &erro) {
+
+    Leitor l(dados, tamanho, linhaAnterior);
+
+    // No máximo um dia por linha: o vetor não é realocado durante a leitura
+    quebras = static_cast<size_t>(std::count(dados, dados + tamanho, '\n'));
+    dias.reserve(dias.size() + quebras + 1);
+
+    std::vector<AtvId> ids;
+
+    while (l.proxima()) {
+        if (0 == l.n) continue;
+
+        // Não há uma quarta seção
+        if ('#' == l.p[0]) {
+            return falha(erro, l, 0, "demarcadores \"#\" invalidos");
+        }
+
+        Day thisDay;
+        bool valido = false;
+
+        if (!parseDia(thisDay, valido, memoria, ids, grafo, l, erro)) return false;
+
+        // Adiciona ao vetor
+        if (valido) dias.push_back(thisDay);
+    }
+
+    return true;
+}
+
+/// Menor terceira seção lida em trechos paralelos (abaixo: uma thread)
+const size_t MIN_EXECUCAO_PARALELA = 256 * 1024;
+
+/// Início da primeira linha que começa em pos ou depois (tamanho: nenhuma)
+size_t inicioDeLinha(const char *dados, size_t tamanho, size_t pos) {
+    if (0 == pos || pos >= tamanho) return std::min(pos, tamanho);
+
+    const auto quebra = static_cast<const char *>(
+            std::memchr(dados + pos - 1, '\n', tamanho - pos + 1));
+    return quebra ? static_cast<size_t>(quebra - dados) + 1 : tamanho;
+}
+
+/// Resultado da leitura de um trecho da terceira seção
+struct Trecho {
+    std::vector<struct Day> dias;
+    Arena memoria;
+    size_t quebras = 0;
+    bool valido = true;
+    ErroParse erro;     // linha relativa ao início do trecho
+};
+
+} // namespace
+
+bool localizaExecucao(const char *dados, size_t tamanho,
+                      size_t &inicio, int &linhaAnterior) {
+
+    Leitor l(dados, tamanho);
+    int demarcadores = 0;
+
+    while (l.proxima()) {
+        if (l.n > 0 && '#' == l.p[0] && 3 == ++demarcadores) {
+            inicio = static_cast<size_t>(l.restante() - dados);
+            linhaAnterior = l.numero;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool parseExecucao(std::vector<struct Day> &dias, Arena &memoria, const Grafo &grafo,
+                   const char *dados, size_t tamanho, int linhaAnterior,
+                   ErroParse &erro) {
+
+    Cronometro cronometro(Etapa::Dias);
+    size_t quebras = 0;
+    return parseTrecho(dias, memoria, grafo, dados, tamanho, linhaAnterior, quebras, erro);
+}
+
+bool parseExecucao(std::vector<struct Day> &dias, Arena &memoria, const Grafo &grafo,
+                   const char *dados, size_t tamanho, int linhaAnterior,
+                   ErroParse &erro, Equipe &equipe) {
+
+    if (1 == equipe.tamanho() || tamanho < MIN_EXECUCAO_PARALELA) {
+        return parseExecucao(dias, memoria, grafo, dados, tamanho, linhaAnterior, erro);
+    }
+
+    Cronometro cronometro(Etapa::Dias);
+
+    // Um trecho de linhas completas por thread: o bloco [de, ate) de bytes
+    // vai do início da primeira linha em de ao início da primeira linha em
+    // ate (trechos vizinhos usam a mesma fronteira)
+    std::vector<Trecho> trechos(equipe.tamanho());
+
+    equipe.divide(tamanho, [&](size_t de, size_t ate, unsigned t) {
+        const auto inicio = inicioDeLinha(dados, tamanho, de);
+        const auto fim = inicioDeLinha(dados, tamanho, ate);
+        if (inicio >= fim) return;
+
+        auto &trecho = trechos[t];
+        trecho.valido = parseTrecho(trecho.dias, trecho.memoria, grafo, dados + inicio,
+                                    fim - inicio, 0, trecho.quebras, trecho.erro);
+    });
+
+    // Primeiro erro na ordem do arquivo, com a linha absoluta
+    auto linha = linhaAnterior;
+    size_t qtde = 0;
+
+    for (const auto &trecho : trechos) {
+        if (!trecho.valido) {
+            erro = trecho.erro;
+            erro.linha += linha;
+            return false;
+        }
+        linha += static_cast<int>(trecho.quebras);
+        qtde += trecho.dias.size();
+    }
+
+    // Junta os dias na ordem do arquivo; as listas continuam nos blocos de
+    // cada trecho, que passam para a arena do projeto
+    dias.reserve(dias.size() + qtde);
+    for (auto &trecho : trechos) {
+        dias.insert(dias.end(), trecho.dias.begin(), trecho.dias.end());
+        memoria.absorve(trecho.memoria);
+    }
+
+    return true;
+}
+
+namespace {
+
+/// parseProjeto com ou sem equipe (nullptr: terceira seção sequencial)
+bool leProjeto(Projeto &projeto, const char *dados, size_t tamanho,
+               ErroParse &erro, Equipe *equipe) {
+
+    Leitor l(dados, tamanho);
+
+    std::vector<Aresta> pares;
+    std::vector<int> linhasPares;   // linha de cada conexão
+    int secao = 0;
+    bool cabecalho = false;
+
+    // Cabeçalho e conexões; a execução dos dias fica para parseExecucao
+    Cronometro secoes(Etapa::Secoes);
+    while (secao < 3 && l.proxima()) {
+
+        // Demarcadores
+        if (l.n > 0 && '#' == l.p[0]) {
+            // Verifica se ha mais de um '#' na linha de demarcação
+            if (std::count(l.p, l.p + l.n, '#') > 1) {
+                return falha(erro, l, l.procura('#', 1), "demarcadores \"##\" invalidos");
+            }
+
+            // Verifica se o cabeçalho esta antes da segunda demarcação
+            if (1 == secao && !cabecalho) {
+                return falha(erro, l, 0, "cabecalho invalido ou nao encontrado");
+            }
+
+            ++secao;
+            continue;
+        }
+
+        if (0 == l.n) continue;
+
+        switch (secao) {
+            case 1:
+                // Verifica se o cabeçalho inicia com "{{" e termina com "}}"
+                if (!cabecalho && l.n > 4 &&
+                    '{' == l.p[0] && '{' == l.p[1] &&
+                    '}' == l.p[l.n - 2] && '}' == l.p[l.n - 1]) {
+                    if (!parseCabecalho(projeto.grafo, l, erro)) return false;
+                    cabecalho = true;
+                }
+                break;
+
+            case 2:
+                // Adiciona as conexões ao vetor
+                if ('{' == l.p[0]) {
+                    if (!parsePar(pares, projeto.grafo, l, erro)) return false;
+                    linhasPares.push_back(l.numero);
+                }
+                break;
+
+            default:
+                // Ignora as linhas ate que se encontre a primeira demarcação
+                break;
+        }
+    }
+
+    secoes.para();
+
+    if (secao != 3) {
+        erro.linha = l.numero;
+        erro.coluna = 1;
+        erro.mensagem = "demarcadores \"#\" invalidos";
+        return false;
+    }
+
+    // Terceira seção: a partir da linha seguinte ao terceiro '#'
+    const auto inicioExecucao = l.restante();
+    const auto bytesExecucao = static_cast<size_t>(dados + tamanho - inicioExecucao);
+    if (!(nullptr == equipe
+          ? parseExecucao(projeto.dias, projeto.memoria, projeto.grafo, inicioExecucao,
+                          bytesExecucao, l.numero, erro)
+          : parseExecucao(projeto.dias, projeto.memoria, projeto.grafo, inicioExecucao,
+                          bytesExecucao, l.numero, erro, *equipe))) {
+        return false;
+    }
+
+    // Monta as listas de sucessores/antecessores (sem duplicatas)
+    std::vector<std::pair<size_t, size_t>> duplicadas;
+    Cronometro arestas(Etapa::Arestas);
+    projeto.grafo.montaArestas(pares, &duplicadas);
+    arestas.para();
+
+    // Conexão repetida: erro na primeira duplicata
+    if (!duplicadas.empty()) {
+        const auto &d = duplicadas.front();
+        const auto &nomes = projeto.grafo.nomes;
+        erro.linha = linhasPares[d.first];
+        erro.coluna = 1;
+        erro.mensagem = "conexao {" + nomes[pares[d.first].first] + "," +
+                        nomes[pares[d.first].second] + "} duplicada (linha " +
+                        std::to_string(linhasPares[d.second]) + ")";
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+bool parseProjeto(Projeto &projeto, const char *dados, size_t tamanho,
+                  ErroParse &erro) {
+    return leProjeto(projeto, dados, tamanho, erro, nullptr);
+}
+
+bool parseProjeto(Projeto &projeto, const char *dados, size_t tamanho,
+                  ErroParse &erro, Equipe &equipe) {
+    return leProjeto(projeto, dados, tamanho, erro, &equipe);
+}
+
+bool parseArquivo(Projeto &projeto, const std::string &filename,
+                  ErroParse &erro) {
+
+    ArquivoMapeado arquivo;
+
+    if (!arquivo.abre(filename, erro.mensagem)) {
+        erro.linha = 0;
+        erro.coluna = 0;
+        return false;
+    }
+
+    return parseProjeto(projeto, arquivo.dados(), arquivo.tamanho(), erro);
+}
@@ -0,0 +1,119 @@
+/// Calculador de Caminho Critico
+/// Leitura do arquivo de entrada (três seções) em uma única passagem
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_PARSER_H
+#define CAMINHO_MISTICO_PARSER_H
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t
+#include <string>       // string
+#include <vector>       // vector
+
+#include "arena.h"      // Arena
+#include "grafo.h"      // Grafo, AtvId
+
+class Equipe;
+
+/// Atividades de um dia: visão sobre a arena do projeto
+struct ListaAtv {
+    const AtvId *dados = nullptr;
+    uint32_t n = 0;
+
+    const AtvId *begin() const { return dados; }
+    const AtvId *end() const { return dados + n; }
+    size_t size() const { return n; }
+    bool empty() const { return 0 == n; }
+};
+
+/// Execução de um dia (sem alocação própria: as listas ficam na arena)
+struct Day {
+    int dia = 0;
+    ListaAtv iniciadas;
+    ListaAtv finalizadas;
+};
+
+/// Projeto extraído do arquivo de entrada
+struct Projeto {
+    /// Grafo das atividades (cabeçalho + conexões)
+    /// Cada nome é internado em um id denso: {id -> "nome", peso}
+    Grafo grafo;
+
+    /// Vetor da execução dos dias
+    /// Formato de armazenamento:
+    /// dia: dia
+    /// iniciadas {atvA, AtvB, ...}
+    /// finalizadas {atvC, AtvD, ...}
+    std::vector<struct Day> dias;
+
+    /// Memória das listas de atividades dos dias (liberada com o projeto)
+    Arena memoria;
+};
+
+/// Erro de leitura com a posição no arquivo (linha e coluna a partir de 1)
+struct ErroParse {
+    int linha = 0;
+    int coluna = 0;
+    std::string mensagem;
+};
+
+/// Extrai o projeto de um buffer com o conteúdo do arquivo
+/// Valida os demarcadores "#" e preenche cabeçalho, conexões e
+/// execução dos dias em uma única passagem
+/// @param projeto projeto de saída
+/// @param dados conteúdo do arquivo
+/// @param tamanho quantidade de bytes
+/// @param erro posição e descrição do erro (caso retorne false)
+/// @return false em caso de erro
+bool parseProjeto(Projeto &projeto, const char *dados, size_t tamanho,
+                  ErroParse &erro);
+
+/// Como parseProjeto, com a terceira seção lida pelas threads da equipe
+/// (ver parseExecucao)
+bool parseProjeto(Projeto &projeto, const char *dados, size_t tamanho,
+                  ErroParse &erro, Equipe &equipe);
+
+/// Extrai somente a execução dos dias (terceira seção)
+/// @param dias dias de saída (acrescentados)
+/// @param memoria arena das listas de atividades dos dias
+/// @param grafo grafo com as atividades do cabeçalho
+/// @param dados conteúdo da terceira seção (após a linha do terceiro '#')
+/// @param tamanho quantidade de bytes
+/// @param linhaAnterior linha do terceiro '#' (numeração dos erros)
+/// @param erro posição e descrição do erro (caso retorne false)
+/// @return false em caso de erro
+bool parseExecucao(std::vector<struct Day> &dias, Arena &memoria, const Grafo &grafo,
+                   const char *dados, size_t tamanho, int linhaAnterior,
+                   ErroParse &erro);
+
+/// Como parseExecucao, em paralelo: uma seção grande é dividida em trechos
+/// de linhas completas, um por thread da equipe (cada um com arena própria,
+/// absorvida por memoria), juntados na ordem do arquivo; o erro informado é
+/// o primeiro do arquivo, como na leitura sequencial
+/// @param equipe threads de trabalho (do chamador, reaproveitadas)
+bool parseExecucao(std::vector<struct Day> &dias, Arena &memoria, const Grafo &grafo,
+                   const char *dados, size_t tamanho, int linhaAnterior,
+                   ErroParse &erro, Equipe &equipe);
+
+/// Localiza o início da terceira seção sem extrair as anteriores
+/// @param dados conteúdo do arquivo
+/// @param tamanho quantidade de bytes
+/// @param inicio deslocamento da linha seguinte ao terceiro '#'
+/// @param linhaAnterior linha do terceiro '#'
+/// @return false caso não haja três demarcadores
+bool localizaExecucao(const char *dados, size_t tamanho,
+                      size_t &inicio, int &linhaAnterior);
+
+/// Mapeia o arquivo em memória e extrai o projeto
+/// @param projeto projeto de saída
+/// @param filename caminho do arquivo
+/// @param erro posição e descrição do erro (caso retorne false)
+/// @return false em caso de erro
+bool parseArquivo(Projeto &projeto, const std::string &filename,
+                  ErroParse &erro);
+
+#endif // CAMINHO_MISTICO_PARSER_H
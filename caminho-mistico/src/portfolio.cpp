@@ -0,0 +1,152 @@
+/// Calculador de Caminho Critico
+/// Portfólio: vários projetos processados em paralelo
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "portfolio.h"
+
+#include <sys/stat.h>   // stat, S_ISDIR
+#include <algorithm>    // sort, min
+#include <atomic>       // atomic
+#include <thread>       // thread
+
+#if defined (_WIN32)
+#  include <windows.h>  // FindFirstFile
+#  ifndef S_ISDIR
+#    define S_ISDIR(mode)  (((mode) & S_IFMT) == S_IFDIR)
+#  endif
+#else
+#  include <dirent.h>   // opendir, readdir
+#endif
+
+/// Lista os arquivos .txt de um diretório
+/// @param arquivos arquivos de saída (acrescentados)
+/// @param dir diretório
+static void listaDiretorio(std::vector<std::string> &arquivos, const std::string &dir) {
+
+    std::vector<std::string> nomes;
+
+#if defined (_WIN32)
+    WIN32_FIND_DATAA info;
+    HANDLE h = FindFirstFileA((dir + "\\*.txt").c_str(), &info);
+    if (h != INVALID_HANDLE_VALUE) {
+        do {
+            nomes.push_back(info.cFileName);
+        } while (FindNextFileA(h, &info));
+        FindClose(h);
+    }
+#else
+    DIR *d = opendir(dir.c_str());
+    if (nullptr == d) return;
+
+    while (const dirent *e = readdir(d)) {
+        const std::string nome(e->d_name);
+        if (nome.size() > 4 && 0 == nome.compare(nome.size() - 4, 4, ".txt")) {
+            nomes.push_back(nome);
+        }
+    }
+    closedir(d);
+#endif
+
+    std::sort(nomes.begin(), nomes.end());
+
+    for (const auto &nome : nomes) {
+        arquivos.push_back(dir + "/" + nome);
+    }
+}
+
+void listaArquivos(std::vector<std::string> &arquivos,
+                   const std::vector<std::string> &entradas) {
+
+    for (const auto &entrada : entradas) {
+        struct stat st;
+
+        if (0 == stat(entrada.c_str(), &st) && S_ISDIR(st.st_mode)) {
+            listaDiretorio(arquivos, entrada);
+        } else {
+            arquivos.push_back(entrada);
+        }
+    }
+}
+
+void executaPortfolio(std::vector<ResumoProjeto> &resumos,
+                      const std::vector<std::string> &arquivos,
+                      unsigned threads, bool cache) {
+
+    resumos.assign(arquivos.size(), ResumoProjeto());
+
+    if (0 == threads) {
+        threads = std::thread::hardware_concurrency();
+        if (0 == threads) threads = 1;
+    }
+    threads = static_cast<unsigned>(
+            std::min<size_t>(threads, std::max<size_t>(arquivos.size(), 1)));
+
+    // Fila de trabalho: índice do próximo arquivo
+    std::atomic<size_t> proximo(0);
+
+    Opcoes opcoes;
+    opcoes.lote = true;
+    opcoes.detalhado = false;
+    opcoes.cache = cache;
+    opcoes.threadsCPM = 1;  // um projeto por thread: sem equipes aninhadas
+
+    auto trabalhador = [&]() {
+        // Sem relatório detalhado: nada é escrito nesta saída
+        std::ostream nula(nullptr);
+
+        for (size_t i = proximo++; i < arquivos.size(); i = proximo++) {
+            executaProjeto(resumos[i], arquivos[i], opcoes, nula, nullptr);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t) {
+        pool.push_back(std::thread(trabalhador));
+    }
+
+    trabalhador(); // a thread principal também trabalha
+
+    for (auto &t : pool) {
+        t.join();
+    }
+}
+
+void printPortfolio(std::ostream &out, const std::vector<ResumoProjeto> &resumos) {
+
+    size_t comErro = 0;
+    size_t comAtraso = 0;
+
+    out << "PORTFOLIO\n--------------\n";
+
+    for (const auto &r : resumos) {
+        out << r.arquivo << "\n";
+
+        if (!r.erro.empty()) {
+            ++comErro;
+            out << "\tERRO: " << r.erro << "\n";
+            continue;
+        }
+
+        out << "\tCaminho critico: duracao(" << r.duracaoCritica << ")"
+            << "  Previsao: " << r.duracaoPrevista
+            << "  Atividades: " << r.atividades
+            << "  Dias: " << r.dias << "\n";
+
+        out << "\tAtrasadas (" << r.atrasadas.size() << "):";
+        for (const auto &nome : r.atrasadas) {
+            out << ' ' << nome;
+        }
+        out << "\n";
+
+        if (!r.atrasadas.empty()) ++comAtraso;
+    }
+
+    out << "--------------\n";
+    out << "Projetos: " << resumos.size()
+        << "  Com atraso: " << comAtraso
+        << "  Com erro: " << comErro << "\n";
+}
@@ -0,0 +1,41 @@
+/// Calculador de Caminho Critico
+/// Portfólio: vários projetos processados em paralelo
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_PORTFOLIO_H
+#define CAMINHO_MISTICO_PORTFOLIO_H
+
+#include <ostream>      // ostream
+#include <string>       // string
+#include <vector>       // vector
+
+#include "relatorio.h"  // ResumoProjeto
+
+/// Expande as entradas: diretórios viram seus arquivos .txt (em ordem
+/// alfabética) e arquivos são mantidos na ordem informada
+/// @param arquivos arquivos de saída
+/// @param entradas diretórios e/ou arquivos
+void listaArquivos(std::vector<std::string> &arquivos,
+                   const std::vector<std::string> &entradas);
+
+/// Processa os projetos em um conjunto de threads (uma por núcleo)
+/// Cada thread executa executaProjeto com estado próprio e sem saída
+/// compartilhada; os resumos ficam na mesma ordem dos arquivos
+/// @param resumos resumos de saída
+/// @param arquivos arquivos dos projetos
+/// @param threads quantidade de threads (0: núcleos disponíveis)
+/// @param cache lê/grava o cache binário de cada projeto
+void executaPortfolio(std::vector<ResumoProjeto> &resumos,
+                      const std::vector<std::string> &arquivos,
+                      unsigned threads, bool cache);
+
+/// Escreve o relatório consolidado do portfólio
+/// @param out saída
+/// @param resumos resumos dos projetos
+void printPortfolio(std::ostream &out, const std::vector<ResumoProjeto> &resumos);
+
+#endif // CAMINHO_MISTICO_PORTFOLIO_H
@@ -0,0 +1,416 @@
+/// Calculador de Caminho Critico
+/// Execução completa de um projeto (leitura, cálculo e relatório)
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "relatorio.h"
+
+#include <cstdlib>      // strtol
+#include <memory>       // unique_ptr
+#include <sstream>      // ostringstream
+
+#include "arquivo.h"    // ArquivoMapeado
+#include "cache.h"      // carregaCache, gravaCache
+#include "cpm.h"        // Estatisticas, Cronograma, Caminhos, MaioresCaminhos
+#include "execucao.h"   // Execucao
+#include "grafo.h"      // Grafo, AtvId
+#include "instrumentacao.h" // Cronometro, conta
+#include "mistico.h"    // montaProjeto, ErroProjeto, descreveErro
+#include "paralelo.h"   // Equipe
+#include "parser.h"     // Projeto, Day, parseExecucao
+#include "reproducao.h" // Reproducao
+#include "simulacao.h"  // simulaProjeto, printSimulacao
+
+// Para modo de compilação
+// Exibe msgs de debug e teste
+#define DEBUG false
+
+/// Escreve uma mensagem na saída do relatório
+/// @param p mensagem
+#define printRelatorio(p) out << p << "\n";
+
+namespace {
+
+/// Exibe os caminhos à medida que são extraídos (sem guardá-los)
+/// @param out saída
+/// @param grafo grafo de dependências
+void printCaminhos(std::ostream &out, const Grafo &grafo) {
+    Cronometro cronometro(Etapa::Caminhos);
+    Caminhos caminhos(grafo);
+    std::vector<AtvId> caminho;
+    size_t i = 0;
+
+    out << "--------------\n";
+    for (; caminhos.proximo(caminho); ++i) {
+        out << "[" << i << "] ";
+        for (const auto v : caminho) {
+            out << grafo.nomes[v] << " ";
+        }
+        out << "\n";
+    }
+    out << "--------------\n\n";
+    conta(Contador::Caminhos, i);
+}
+
+/// Exibe as estatísticas de uma determinada atividade
+/// @param out saída
+/// @param atividade
+void printStatistics(std::ostream &out, const std::pair<std::string, Estatisticas> &atividade) {
+    printRelatorio("Atividade: " << atividade.first);
+    printRelatorio("Peso: " << atividade.second.peso);
+#if DEBUG
+    printRelatorio("Iniciada: " << (atividade.second.iniciada ? "sim" : "nao"));
+    printRelatorio("Finalizada: " << (atividade.second.finalizada ? "sim" : "nao"));
+#endif
+    printRelatorio("Early Start (ES): " << atividade.second.earlyStart);
+    printRelatorio("Early Finish (EF): " << atividade.second.earlyFinish);
+    printRelatorio("Late Start (LS): " << atividade.second.lateStart);
+    printRelatorio("Late Finish (LF): " << atividade.second.lateFinish);
+    printRelatorio("Slack (SL): " << atividade.second.slack);
+}
+
+/// Exibe os caminhos e o(s) caminho(s) crítico(s)
+/// @param out saída
+/// @param grafo grafo de dependências
+/// @param cronograma cronograma estático
+/// @param limite máximo de caminhos críticos exibidos (0: todos)
+void printCriticos(std::ostream &out, const Grafo &grafo,
+                   const Cronograma &cronograma, size_t limite) {
+
+    // Imprime os caminhos
+    printRelatorio("CAMINHOS");
+    printCaminhos(out, grafo);
+
+    printRelatorio("CRITICO(S)\n--------------");
+    printRelatorio("Caminho(s) critico(s): duracao(" << cronograma.duracao << ")");
+
+    // Contados sobre o subgrafo de folga zero e extraídos um a um
+    Cronometro cronometro(Etapa::Criticos);
+    CaminhosCriticos criticos(grafo, cronograma);
+
+    printRelatorio("Quantidade: " << (criticos.saturada() ? ">= " : "")
+                                  << criticos.quantidade());
+
+    std::vector<AtvId> caminho;
+    size_t index = 0;
+
+    for (; (0 == limite || index < limite) && criticos.proximo(caminho); ++index) {
+        out << "\t[" << index << "]: ";
+
+        for (size_t j = 0; j < caminho.size(); ++j) {
+            if (0 != j) out << " - ";
+            const auto v = caminho[j];
+            out << grafo.nomes[v] << '(' << grafo.peso[v] << ')';
+        }
+
+        out << '\n';
+    }
+
+    conta(Contador::Criticos, index);
+
+    if (index < criticos.quantidade()) {
+        printRelatorio("\t... (exibido(s) " << index << ")");
+    }
+    printRelatorio("--------------\n");
+}
+
+/// Exibe os k caminhos mais longos (críticos e quase críticos)
+/// @param out saída
+/// @param grafo grafo de dependências
+/// @param cronograma cronograma estático
+/// @param k quantidade de caminhos
+void printMaiores(std::ostream &out, const Grafo &grafo,
+                  const Cronograma &cronograma, size_t k) {
+
+    printRelatorio("MAIORES CAMINHOS\n--------------");
+
+    Cronometro cronometro(Etapa::Maiores);
+    MaioresCaminhos maiores(grafo);
+    std::vector<AtvId> caminho;
+    int duracao = 0;
+
+    for (size_t index = 0; index < k && maiores.proximo(caminho, duracao); ++index) {
+        out << "\t[" << index << "]: duracao(" << duracao << ") folga("
+            << cronograma.duracao - duracao << "): ";
+
+        for (size_t j = 0; j < caminho.size(); ++j) {
+            if (0 != j) out << " - ";
+            const auto v = caminho[j];
+            out << grafo.nomes[v] << '(' << grafo.peso[v] << ')';
+        }
+
+        out << '\n';
+    }
+
+    printRelatorio("--------------\n");
+}
+
+/// Exibe a previsão e as estatísticas dinâmicas de todas as atividades
+/// @param out saída
+/// @param grafo grafo de dependências
+/// @param execucao execução reproduzida até o dia desejado
+/// @param titulo título da seção
+void printEstado(std::ostream &out, const Grafo &grafo, const Execucao &execucao,
+                 const std::string &titulo) {
+    const auto &dinamico = execucao.escalonador();
+
+    printRelatorio("\n" << titulo << "\n--------------");
+    printRelatorio("Duracao prevista do projeto: " << dinamico.duracao());
+    for (const auto v : execucao.atividades()) {
+        printRelatorio("---------");
+        printStatistics(out, std::make_pair(grafo.nomes[v], dinamico.atividade(v)));
+    }
+}
+
+/// Lê o dia digitado no modo interativo (somente dígitos, espaços ao redor)
+/// @param linha linha digitada
+/// @param dia dia lido
+/// @return false caso a linha não seja um dia (ENTER: próximo dia)
+bool leDiaDigitado(const std::string &linha, int &dia) {
+    const char *p = linha.c_str();
+    while (' ' == *p || '\t' == *p) ++p;
+    if (*p < '0' || *p > '9') return false;
+
+    char *fim = nullptr;
+    const long valor = std::strtol(p, &fim, 10);
+    while (' ' == *fim || '\t' == *fim || '\r' == *fim) ++fim;
+    if ('\0' != *fim || valor > 1000000000L) return false;
+
+    dia = static_cast<int>(valor);
+    return true;
+}
+
+/// Descreve um erro de leitura ("linha L, coluna C: mensagem")
+std::string descreveErro(const ErroParse &erro) {
+    std::ostringstream msg;
+    if (erro.linha > 0) {
+        msg << "linha " << erro.linha << ", coluna " << erro.coluna << ": ";
+    }
+    msg << erro.mensagem;
+    return msg.str();
+}
+
+} // namespace
+
+bool preparaProjeto(Projeto &projeto, Cronograma &estatistica,
+                    const std::string &arquivo, const Opcoes &opcoes, std::string &erro,
+                    size_t *lidos) {
+
+    bool usaCache = opcoes.cache;
+
+    ArquivoMapeado texto;
+    ErroParse erroParse;
+
+    Cronometro abertura(Etapa::Arquivo);
+    if (!texto.abre(arquivo, erroParse.mensagem)) {
+        erro = descreveErro(erroParse);
+        return false;
+    }
+    abertura.para();
+
+    // Acompanhamento: a última linha da terceira seção pode estar sendo
+    // escrita; a leitura termina na última quebra e o restante fica para o
+    // chamador (a partir de *lidos)
+    auto tamanho = texto.tamanho();
+    if (lidos) {
+        auto fimLinhas = tamanho;
+        while (fimLinhas > 0 && '\n' != texto.dados()[fimLinhas - 1]) --fimLinhas;
+
+        size_t inicio = 0;
+        int linha = 0;
+        if (fimLinhas < tamanho && localizaExecucao(texto.dados(), tamanho, inicio, linha) &&
+            fimLinhas >= inicio) {
+            tamanho = fimLinhas;
+        }
+        *lidos = tamanho;
+    }
+
+    size_t inicioExecucao = 0;
+    int linhaExecucao = 0;
+    uint64_t hash = 0;
+
+    // Uma equipe para a leitura dos dias e o cronograma (nenhuma: sequencial)
+    std::unique_ptr<Equipe> equipe;
+    if (1 != opcoes.threadsCPM) equipe.reset(new Equipe(opcoes.threadsCPM));
+
+    usaCache = usaCache && localizaExecucao(texto.dados(), tamanho,
+                                            inicioExecucao, linhaExecucao);
+
+    if (usaCache) {
+        hash = hashSecoes(texto.dados(), inicioExecucao);
+
+        Cronometro leituraCache(Etapa::Cache);
+        const bool carregado = carregaCache(projeto.grafo, estatistica,
+                                            arquivoCache(arquivo), hash);
+        leituraCache.para();
+
+        if (carregado) {
+            conta(Contador::Bytes, tamanho - inicioExecucao);
+            conta(Contador::Atividades, projeto.grafo.tamanho());
+            conta(Contador::Conexoes, projeto.grafo.qtdeArestas());
+
+            // Somente os dias são lidos do texto
+            const auto dados = texto.dados() + inicioExecucao;
+            const auto bytes = tamanho - inicioExecucao;
+            if (!(equipe ? parseExecucao(projeto.dias, projeto.memoria, projeto.grafo, dados,
+                                         bytes, linhaExecucao, erroParse, *equipe)
+                         : parseExecucao(projeto.dias, projeto.memoria, projeto.grafo, dados,
+                                         bytes, linhaExecucao, erroParse))) {
+                erro = descreveErro(erroParse);
+                return false;
+            }
+            return true;
+        }
+    }
+
+    conta(Contador::Bytes, tamanho);
+
+    ErroProjeto erroProjeto;
+    if (!(equipe ? montaProjeto(projeto, estatistica, erroProjeto, texto.dados(), tamanho,
+                                *equipe)
+                 : montaProjeto(projeto, estatistica, erroProjeto, texto.dados(), tamanho, 1))) {
+        erro = descreveErro(erroProjeto);
+        return false;
+    }
+
+    // Falha ao gravar (diretório somente leitura etc.) não é erro
+    if (usaCache) {
+        Cronometro gravacaoCache(Etapa::Cache);
+        gravaCache(arquivoCache(arquivo), hash, projeto.grafo, estatistica);
+    }
+
+    return true;
+}
+
+bool executaProjeto(ResumoProjeto &resumo,
+                    const std::string &arquivo,
+                    const Opcoes &opcoes,
+                    std::ostream &out,
+                    std::istream *entrada) {
+
+    resumo = ResumoProjeto();
+    resumo.arquivo = arquivo;
+
+    if (opcoes.detalhado) {
+        printRelatorio("\n");
+    }
+
+    /// Projeto: grafo das atividades (cabeçalho + conexões)
+    /// e execução dos dias; estatísticas de cada atividade, indexadas pelo id
+    Projeto projeto;
+    Cronograma estatistica;
+
+    if (!preparaProjeto(projeto, estatistica, arquivo, opcoes, resumo.erro)) {
+        return false;
+    }
+
+    const Grafo &grafo = projeto.grafo;
+    const std::vector<struct Day> &dias = projeto.dias;
+
+    const auto max = estatistica.duracao;
+
+    // Execução dia a dia (reprogramação incremental); no modo interativo,
+    // com pontos de restauração para os saltos a um dia qualquer
+    const bool interativo = opcoes.detalhado && !opcoes.lote && nullptr != entrada;
+
+    Reproducao reproducao;
+    reproducao.inicializa(grafo, estatistica, dias, interativo ? INTERVALO_PONTOS : 0);
+    const Execucao &execucao = reproducao.execucao();
+
+    resumo.duracaoCritica = max;
+    resumo.atividades = execucao.atividades().size();
+    resumo.dias = dias.size();
+
+    if (opcoes.detalhado) {
+#if DEBUG
+        // Imprime o cabeçalho
+        printRelatorio("CABECALHO\n--------------");
+        for (AtvId v = 0; v < grafo.tamanho(); ++v) {
+            printRelatorio(grafo.nomes[v] << ": " << grafo.peso[v]);
+        }
+        printRelatorio("--------------\n");
+
+        // Imprime as ligações
+        printRelatorio("PARES\n--------------");
+        for (AtvId v = 0; v < grafo.tamanho(); ++v) {
+            for (auto s = grafo.sucBegin(v); s != grafo.sucEnd(v); ++s) {
+                printRelatorio(grafo.nomes[v] << " " << grafo.nomes[*s]);
+            }
+        }
+        printRelatorio("--------------\n");
+#endif
+
+        printCriticos(out, grafo, estatistica, opcoes.limiteCriticos);
+        if (opcoes.maioresCaminhos > 0) {
+            printMaiores(out, grafo, estatistica, opcoes.maioresCaminhos);
+        }
+
+        // Imprime as estatísticas estáticas (!)
+        for (const auto v : execucao.atividades()) {
+            printRelatorio("---------");
+            printStatistics(out, std::make_pair(grafo.nomes[v], estatistica.atividade(grafo, v)));
+        }
+
+        // Distribuição do prazo (estimativas de três pontos)
+        if (opcoes.amostras > 0) {
+            ParametrosSimulacao parametros;
+            parametros.amostras = opcoes.amostras;
+            parametros.threads = opcoes.threadsSimulacao;
+
+            ResultadoSimulacao simulacao;
+            Cronometro cronometro(Etapa::Simulacao);
+            simulaProjeto(simulacao, grafo, parametros);
+            cronometro.para();
+
+            printRelatorio("");
+            printSimulacao(out, grafo, simulacao);
+        }
+
+        // Interação com o usuário
+        // Exibe as estatísticas dinâmicas a cada ENTER pressionado;
+        // um número leva ao estado após aquele dia (para trás ou para frente)
+        printRelatorio("\nESTATISTICAS\n--------------------------------------------------");
+    }
+
+    Cronometro cronometro(Etapa::Reproducao);
+    while (reproducao.posicao() < dias.size()) {
+        if (interativo) {
+            out << "\nPressione ENTER (ou digite um dia):";
+            out.flush();
+
+            std::string linha;
+            std::getline(*entrada, linha);
+
+            int dia;
+            if (leDiaDigitado(linha, dia)) {
+                reproducao.vaiPara(reproducao.posicaoDoDia(dia));
+                printEstado(out, grafo, execucao,
+                            "ESTADO APOS O DIA " + std::to_string(execucao.dia()));
+                continue;
+            }
+        }
+
+        reproducao.avanca(opcoes.detalhado ? &out : nullptr);
+    }
+
+    cronometro.para();
+
+    const auto &dinamico = execucao.escalonador();
+    resumo.duracaoPrevista = dinamico.duracao();
+
+    std::vector<AtvId> atrasadas;
+    execucao.atrasadas(atrasadas);
+    for (const auto v : atrasadas) {
+        resumo.atrasadas.push_back(grafo.nomes[v]);
+    }
+
+    if (opcoes.detalhado && opcoes.lote) {
+        // Estado final: previsão após todos os dias registrados
+        printEstado(out, grafo, execucao, "ESTADO FINAL");
+    }
+
+    return true;
+}
@@ -0,0 +1,85 @@
+/// Calculador de Caminho Critico
+/// Execução completa de um projeto (leitura, cálculo e relatório)
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_RELATORIO_H
+#define CAMINHO_MISTICO_RELATORIO_H
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+#include <istream>      // istream
+#include <ostream>      // ostream
+#include <string>       // string
+#include <vector>       // vector
+
+/// Opções de execução de um projeto
+struct Opcoes {
+    /// Processa todos os dias sem aguardar ENTER
+    bool lote = false;
+    /// Relatório completo (caminhos, estatísticas e alertas de cada dia);
+    /// false: somente o resumo é preenchido
+    bool detalhado = true;
+    /// Máximo de caminhos críticos exibidos (0: todos)
+    size_t limiteCriticos = 0;
+    /// Caminhos mais longos exibidos além dos críticos (0: nenhum)
+    size_t maioresCaminhos = 0;
+    /// Lê/grava o cache binário (.cmc) ao lado do arquivo
+    bool cache = false;
+    /// Threads da leitura dos dias e do cálculo do cronograma (1: sequencial;
+    /// 0: núcleos disponíveis)
+    unsigned threadsCPM = 1;
+    /// Amostras da simulação de Monte Carlo (0: sem simulação)
+    uint64_t amostras = 0;
+    /// Threads da simulação (0: núcleos disponíveis)
+    unsigned threadsSimulacao = 0;
+};
+
+/// Resumo de um projeto (para relatórios consolidados)
+struct ResumoProjeto {
+    std::string arquivo;
+    /// Descrição do erro (vazio: sucesso)
+    std::string erro;
+    int duracaoCritica = 0;
+    int duracaoPrevista = 0;
+    size_t atividades = 0;
+    size_t dias = 0;
+    std::vector<std::string> atrasadas;
+};
+
+struct Projeto;
+struct Cronograma;
+
+/// Lê e valida o projeto e calcula o cronograma estático (sem exibir nada)
+/// Com cache: se as duas primeiras seções não mudaram (hash), o grafo e o
+/// cronograma vêm do arquivo binário e somente a terceira seção é lida;
+/// caso contrário o cache é regravado após a leitura completa
+/// @param projeto projeto de saída
+/// @param estatistica cronograma estático de saída
+/// @param arquivo caminho do arquivo
+/// @param opcoes opções de execução (cache e threads do cálculo)
+/// @param erro descrição do erro (caso retorne false)
+/// @param lidos bytes do arquivo lidos (opcional; ver segueProjeto)
+/// @return false em caso de erro
+bool preparaProjeto(Projeto &projeto, Cronograma &estatistica,
+                    const std::string &arquivo, const Opcoes &opcoes, std::string &erro,
+                    size_t *lidos = nullptr);
+
+/// Lê, calcula e reproduz a execução de um projeto
+/// Reentrante: todo o estado pertence à chamada e toda a saída vai para out
+/// @param resumo resumo de saída
+/// @param arquivo caminho do arquivo
+/// @param opcoes opções de execução
+/// @param out saída do relatório
+/// @param entrada entrada para o ENTER entre os dias (nullptr: não aguarda)
+/// @return false em caso de erro (descrito em resumo.erro)
+bool executaProjeto(ResumoProjeto &resumo,
+                    const std::string &arquivo,
+                    const Opcoes &opcoes,
+                    std::ostream &out,
+                    std::istream *entrada);
+
+#endif // CAMINHO_MISTICO_RELATORIO_H
@@ -0,0 +1,75 @@
+/// Calculador de Caminho Critico
+/// Reprodução dos dias com pontos de restauração (acesso direto a um dia)
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "reproducao.h"
+
+#include <algorithm>    // max, min, upper_bound
+
+bool Reproducao::inicializa(const Grafo &grafo, const Cronograma &c,
+                            const std::vector<struct Day> &d, size_t i) {
+
+    cronograma = &c;
+    dias = &d;
+    intervalo = i;
+    atual = 0;
+
+    if (!exec.inicializa(grafo, c)) {
+        return false;
+    }
+
+    maiorDia.clear();
+    maiorDia.reserve(d.size());
+    for (const auto &dia : d) {
+        maiorDia.push_back(maiorDia.empty() ? dia.dia : std::max(maiorDia.back(), dia.dia));
+    }
+
+    // Ponto inicial: nenhuma atividade alterada
+    guardados.assign(1, Execucao::Ponto());
+    exec.salva(guardados.front());
+
+    return true;
+}
+
+bool Reproducao::avanca(std::ostream *out) {
+
+    if (atual >= dias->size()) return false;
+
+    exec.processaDia((*dias)[atual], out);
+    ++atual;
+
+    // Primeira passagem por um múltiplo do intervalo: guarda o ponto
+    if (0 != intervalo && 0 == atual % intervalo && atual / intervalo == guardados.size()) {
+        guardados.push_back(Execucao::Ponto());
+        exec.salva(guardados.back());
+    }
+
+    return true;
+}
+
+void Reproducao::vaiPara(size_t posicao) {
+
+    posicao = std::min(posicao, dias->size());
+
+    // Último ponto guardado até o destino; o estado atual serve quando
+    // está entre esse ponto e o destino
+    const size_t ponto = (0 == intervalo)
+                         ? 0 : std::min(posicao / intervalo, guardados.size() - 1);
+    const size_t inicioPonto = ponto * intervalo;
+
+    if (atual > posicao || atual < inicioPonto) {
+        exec.restaura(guardados[ponto], *cronograma);
+        atual = inicioPonto;
+    }
+
+    while (atual < posicao) avanca(nullptr);
+}
+
+size_t Reproducao::posicaoDoDia(int dia) const {
+    return static_cast<size_t>(std::upper_bound(maiorDia.begin(), maiorDia.end(), dia) -
+                               maiorDia.begin());
+}
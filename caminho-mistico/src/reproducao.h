@@ -0,0 +1,82 @@
+/// Calculador de Caminho Critico
+/// Reprodução dos dias com pontos de restauração (acesso direto a um dia)
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_REPRODUCAO_H
+#define CAMINHO_MISTICO_REPRODUCAO_H
+
+#include <cstddef>      // size_t
+#include <ostream>      // ostream
+#include <vector>       // vector
+
+#include "cpm.h"        // Cronograma
+#include "execucao.h"   // Execucao
+#include "grafo.h"      // Grafo
+#include "parser.h"     // Day
+
+/// Dias reproduzidos entre dois pontos de restauração
+const size_t INTERVALO_PONTOS = 64;
+
+/// Reprodução dos dias do arquivo com saltos para qualquer dia
+///
+/// A cada `intervalo` dias reproduzidos pela primeira vez, o estado é
+/// guardado em um ponto de restauração compacto (somente as atividades
+/// alteradas desde o início, ver Execucao::salva). Um salto, para trás ou
+/// para frente, restaura o último ponto anterior ao destino e reproduz
+/// somente os dias restantes (sem alertas):
+///     - dia -> posição: busca binária, O(log D)
+///     - restauração: O(atividades alteradas) + no máximo `intervalo` dias
+/// Somente um salto além dos dias já reproduzidos percorre os dias novos
+/// (guardando os pontos pelo caminho)
+class Reproducao {
+public:
+    /// @param grafo grafo de dependências (deve sobreviver à reprodução)
+    /// @param cronograma cronograma estático (idem)
+    /// @param dias dias do arquivo, em ordem (idem)
+    /// @param intervalo dias entre dois pontos (0: somente o ponto inicial)
+    /// @return false caso o grafo contenha um ciclo
+    bool inicializa(const Grafo &grafo, const Cronograma &cronograma,
+                    const std::vector<struct Day> &dias,
+                    size_t intervalo = INTERVALO_PONTOS);
+
+    /// Reproduz o próximo dia
+    /// @param out saída dos alertas (nullptr: somente aplica os eventos)
+    /// @return false caso todos os dias já tenham sido reproduzidos
+    bool avanca(std::ostream *out);
+
+    /// Vai para o estado após os primeiros `posicao` dias (sem alertas)
+    /// @param posicao dias aplicados (limitada à quantidade de dias)
+    void vaiPara(size_t posicao);
+
+    /// Posição logo após o último dia registrado até `dia`, inclusive
+    /// (dias fora de ordem: até o primeiro dia posterior a `dia`)
+    size_t posicaoDoDia(int dia) const;
+
+    /// Dias aplicados
+    size_t posicao() const { return atual; }
+
+    const Execucao &execucao() const { return exec; }
+
+    /// Pontos de restauração guardados
+    size_t pontos() const { return guardados.size(); }
+
+private:
+    const Cronograma *cronograma = nullptr;
+    const std::vector<struct Day> *dias = nullptr;
+    size_t intervalo = INTERVALO_PONTOS;
+    size_t atual = 0;
+
+    Execucao exec;
+
+    /// guardados[i]: estado após i * intervalo dias
+    std::vector<Execucao::Ponto> guardados;
+
+    /// Maior dia entre os primeiros i + 1 dias (não decrescente)
+    std::vector<int> maiorDia;
+};
+
+#endif // CAMINHO_MISTICO_REPRODUCAO_H
@@ -0,0 +1,244 @@
+/// Calculador de Caminho Critico
+/// Modo "seguir": acompanha a terceira seção enquanto ela cresce
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "seguidor.h"
+
+#include <algorithm>    // count
+#include <chrono>       // milliseconds
+#include <fstream>      // ifstream
+#include <thread>       // sleep_for
+#include <vector>       // vector
+
+#include <sys/stat.h>   // stat
+
+#if defined (__linux__)
+#  include <poll.h>         // poll
+#  include <sys/inotify.h>  // inotify_init1, inotify_add_watch
+#  include <unistd.h>       // read, close
+#endif
+
+#include "arquivo.h"    // ArquivoMapeado
+#include "cpm.h"        // Cronograma
+#include "execucao.h"   // Execucao
+#include "parser.h"     // Projeto, parseExecucao
+
+namespace {
+
+/// Intervalo entre consultas do tamanho (sem inotify ou sem eventos)
+const int INTERVALO_MS = 500;
+
+/// Espera por alterações em um arquivo
+class Observador {
+public:
+    explicit Observador(const std::string &arquivo) : caminho(arquivo) {
+#if defined (__linux__)
+        fd = inotify_init1(IN_CLOEXEC);
+        observa();
+#endif
+    }
+
+    ~Observador() {
+#if defined (__linux__)
+        if (fd >= 0) close(fd);
+#endif
+    }
+
+    Observador(const Observador &) = delete;
+    Observador &operator=(const Observador &) = delete;
+
+    /// Aguarda uma alteração ou o intervalo de consulta
+    /// @return true caso o arquivo tenha sido movido, removido ou substituído
+    bool aguarda() {
+#if defined (__linux__)
+        if (fd >= 0) {
+            // Arquivo removido e recriado: o observador precisa ser refeito
+            if (watch < 0) observa();
+
+            pollfd p = {fd, POLLIN, 0};
+            if (poll(&p, 1, INTERVALO_MS) <= 0) return false;
+
+            alignas(inotify_event) char buffer[4096];
+            const auto n = read(fd, buffer, sizeof(buffer));
+            bool substituido = false;
+
+            for (ssize_t i = 0; i < n;) {
+                const auto e = reinterpret_cast<const inotify_event *>(buffer + i);
+                if (e->mask & (IN_MOVE_SELF | IN_DELETE_SELF | IN_IGNORED)) substituido = true;
+                i += static_cast<ssize_t>(sizeof(inotify_event) + e->len);
+            }
+
+            if (substituido) {
+                inotify_rm_watch(fd, watch);
+                watch = -1;
+                observa();
+            }
+            return substituido;
+        }
+#endif
+        std::this_thread::sleep_for(std::chrono::milliseconds(INTERVALO_MS));
+        return false;
+    }
+
+private:
+#if defined (__linux__)
+    void observa() {
+        if (fd >= 0) {
+            watch = inotify_add_watch(fd, caminho.c_str(),
+                                      IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB |
+                                      IN_MOVE_SELF | IN_DELETE_SELF);
+        }
+    }
+
+    int fd = -1;
+    int watch = -1;
+#endif
+    std::string caminho;
+};
+
+/// Motivo do fim do acompanhamento
+enum class Fim {
+    Removido,
+    Relido
+};
+
+/// Lê o projeto e acompanha o arquivo até que seja removido ou precise ser relido
+Fim acompanha(const std::string &arquivo, const Opcoes &opcoes,
+              std::ostream &out, std::string &erro, bool &ok) {
+
+    Projeto projeto;
+    Cronograma estatistica;
+    size_t lido = 0;
+
+    // Identidade do arquivo lido (antes da leitura: uma troca no meio dela
+    // também é percebida e provoca nova leitura)
+    struct stat original;
+    if (0 != stat(arquivo.c_str(), &original)) {
+        original.st_dev = 0;
+        original.st_ino = 0;
+        original.st_mtime = 0;
+    }
+    auto modificado = original.st_mtime;
+
+    ok = preparaProjeto(projeto, estatistica, arquivo, opcoes, erro, &lido);
+    if (!ok) return Fim::Removido;
+
+    const auto &grafo = projeto.grafo;
+
+    Execucao execucao;
+    execucao.inicializa(grafo, estatistica);
+
+    for (const auto &d : projeto.dias) {
+        execucao.processaDia(d, nullptr);
+    }
+
+    // Numeração das linhas para os erros (somente na leitura inicial) e a
+    // última linha ainda incompleta, que aguarda o restante em pendente
+    int linha = 0;
+    std::string pendente;
+    {
+        ArquivoMapeado texto;
+        if (texto.abre(arquivo, erro)) {
+            const auto fim = texto.dados() + std::min(lido, texto.tamanho());
+            linha = static_cast<int>(std::count(texto.dados(), fim, '\n'));
+            pendente.assign(fim, texto.dados() + texto.tamanho());
+            lido = std::max(lido, texto.tamanho());
+        }
+    }
+
+    out << "Seguindo " << arquivo << ": " << projeto.dias.size() << " dia(s), "
+        << "duracao prevista " << execucao.escalonador().duracao() << "\n";
+    out.flush();
+
+    Observador observador(arquivo);
+    std::ifstream entrada(arquivo, std::ios::binary);
+    std::vector<char> bloco;
+    std::vector<struct Day> novos;
+
+    // Linhas completas de pendente, uma a uma (um erro não descarta as demais)
+    auto processaLinhas = [&]() {
+        size_t inicio = 0;
+        size_t quebra;
+
+        while ((quebra = pendente.find('\n', inicio)) != std::string::npos) {
+            ErroParse erroParse;
+            novos.clear();
+
+            if (!parseExecucao(novos, projeto.memoria, grafo, pendente.data() + inicio,
+                               quebra - inicio, linha, erroParse)) {
+                out << "\nERRO: linha " << erroParse.linha << ", coluna " << erroParse.coluna
+                    << ": " << erroParse.mensagem << " (linha ignorada)\n";
+            }
+
+            for (const auto &d : novos) execucao.processaDia(d, &out);
+
+            ++linha;
+            inicio = quebra + 1;
+        }
+
+        pendente.erase(0, inicio);
+        out.flush();
+    };
+
+    // Linhas terminadas entre a leitura inicial e o mapeamento acima
+    processaLinhas();
+
+    // Movido, removido ou substituído desde a leitura (persiste enquanto o
+    // arquivo é recriado)
+    bool substituido = false;
+
+    for (;;) {
+        if (observador.aguarda()) substituido = true;
+
+        struct stat st;
+        if (0 != stat(arquivo.c_str(), &st)) {
+            if (substituido) continue; // pode estar sendo recriado
+            out << "\nArquivo removido: fim do acompanhamento.\n";
+            return Fim::Removido;
+        }
+
+        // Outro arquivo no mesmo caminho (rename ou recriação, inclusive
+        // sem inotify): o conteúdo pode ser outro mesmo com o mesmo tamanho
+        if (st.st_dev != original.st_dev || st.st_ino != original.st_ino) substituido = true;
+
+        const auto tamanho = static_cast<size_t>(st.st_size);
+
+        // Reescrito no lugar com o mesmo tamanho (acréscimos mudam o tamanho)
+        if (tamanho == lido && st.st_mtime != modificado) substituido = true;
+
+        if (tamanho < lido || substituido) {
+            out << "\nArquivo truncado ou substituido: lendo novamente.\n";
+            return Fim::Relido;
+        }
+
+        if (tamanho == lido) continue;
+        modificado = st.st_mtime;
+
+        // Somente os bytes acrescentados
+        if (!entrada.is_open()) {
+            entrada.open(arquivo, std::ios::binary);
+        }
+        entrada.clear();
+        entrada.seekg(static_cast<std::streamoff>(lido));
+        bloco.resize(tamanho - lido);
+        entrada.read(bloco.data(), static_cast<std::streamsize>(bloco.size()));
+        const auto n = static_cast<size_t>(entrada.gcount());
+        lido += n;
+        pendente.append(bloco.data(), n);
+
+        processaLinhas();
+    }
+}
+
+} // namespace
+
+bool segueProjeto(const std::string &arquivo, const Opcoes &opcoes,
+                  std::ostream &out, std::string &erro) {
+    bool ok = true;
+    while (Fim::Relido == acompanha(arquivo, opcoes, out, erro, ok)) {}
+    return ok;
+}
@@ -0,0 +1,37 @@
+/// Calculador de Caminho Critico
+/// Modo "seguir": acompanha a terceira seção enquanto ela cresce
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_SEGUIDOR_H
+#define CAMINHO_MISTICO_SEGUIDOR_H
+
+#include <ostream>      // ostream
+#include <string>       // string
+
+#include "relatorio.h"  // Opcoes
+
+/// Acompanha um arquivo cuja execução dos dias é acrescentada por outra
+/// ferramenta
+///
+/// Após a leitura inicial (os dias já registrados são aplicados sem
+/// alertas), aguarda alterações no arquivo (inotify no Linux; consulta
+/// periódica do tamanho nas demais plataformas), lê somente os bytes
+/// acrescentados e exibe os alertas de cada novo dia. O custo de uma
+/// atualização não depende do histórico já lido
+///     - linhas incompletas (sem '\n') aguardam o restante
+///     - linhas inválidas são descritas e ignoradas
+///     - arquivo truncado ou substituído: o projeto é lido novamente
+/// Retorna quando o arquivo é removido
+/// @param arquivo caminho do arquivo
+/// @param opcoes opções de leitura (cache e threads do cálculo)
+/// @param out saída dos alertas
+/// @param erro descrição do erro (caso retorne false)
+/// @return false em caso de erro na leitura do projeto
+bool segueProjeto(const std::string &arquivo, const Opcoes &opcoes,
+                  std::ostream &out, std::string &erro);
+
+#endif // CAMINHO_MISTICO_SEGUIDOR_H
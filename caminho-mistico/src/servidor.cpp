@@ -0,0 +1,385 @@
+/// Calculador de Caminho Critico
+/// Servidor de consultas: projeto carregado uma vez, consultas por linha
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "servidor.h"
+
+#include <algorithm>    // max
+#include <cerrno>       // errno, ERANGE, EINTR
+#include <chrono>       // steady_clock
+#include <climits>      // INT_MAX
+#include <cstdlib>      // strtol
+#include <cstring>      // memcpy
+#include <iomanip>      // setprecision
+#include <sstream>      // ostringstream
+#include <vector>       // vector
+
+#if !defined (_WIN32)
+#  include <csignal>      // sigaction, SIGINT, SIGTERM
+#  include <sys/socket.h> // socket, bind, listen, accept, send
+#  include <sys/un.h>     // sockaddr_un
+#  include <unistd.h>     // read, close, unlink
+#endif
+
+namespace {
+
+/// Ignora espaços a partir de p
+const char *pulaEspacos(const char *p, const char *fim) {
+    while (p < fim && (' ' == *p || '\t' == *p || '\r' == *p)) ++p;
+    return p;
+}
+
+/// Extrai a próxima palavra (até um espaço)
+const char *palavra(std::string &saida, const char *p, const char *fim) {
+    p = pulaEspacos(p, fim);
+    const char *q = p;
+    while (q < fim && ' ' != *q && '\t' != *q && '\r' != *q) ++q;
+    saida.assign(p, q);
+    return q;
+}
+
+/// Extrai um inteiro em [0, INT_MAX]
+bool inteiro(int &valor, const std::string &texto) {
+    if (texto.empty()) return false;
+    char *resto = nullptr;
+    errno = 0;
+    const long v = std::strtol(texto.c_str(), &resto, 10);
+    if (*resto != '\0' || ERANGE == errno || v < 0 || v > INT_MAX) return false;
+    valor = static_cast<int>(v);
+    return true;
+}
+
+#if !defined (_WIN32)
+/// SIGINT/SIGTERM recebido durante atendeSocket
+volatile sig_atomic_t sinalRecebido = 0;
+
+void registraSinal(int) {
+    sinalRecebido = 1;
+}
+#endif
+
+} // namespace
+
+bool Servidor::carrega(const std::string &arquivo, const Opcoes &opcoes, std::string &erro) {
+
+    if (!preparaProjeto(projeto, estatico, arquivo, opcoes, erro)) {
+        return false;
+    }
+
+    execucao.inicializa(projeto.grafo, estatico);
+
+    for (const auto &d : projeto.dias) {
+        execucao.processaDia(d, nullptr);
+    }
+
+    return true;
+}
+
+bool Servidor::responde(const std::string &consulta, std::ostream &out) {
+
+    const auto t0 = std::chrono::steady_clock::now();
+
+    const char *p = consulta.data();
+    const char *fim = p + consulta.size();
+
+    std::string comando;
+    p = palavra(comando, p, fim);
+
+    if (comando.empty()) return true;
+    if ("sair" == comando) return false;
+    if ("desligar" == comando) {
+        desliga = true;
+        return false;
+    }
+
+    std::ostringstream resposta;
+    std::string erro;
+    const bool ok = executa(comando, p, fim, resposta, erro);
+
+    const auto us = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - t0).count() / 1e3;
+
+    ++consultas;
+    totalUs += us;
+    maiorUs = std::max(maiorUs, us);
+
+    out << resposta.str();
+    if (ok) {
+        out << "ok " << std::fixed << std::setprecision(1) << us << "us\n";
+    } else {
+        out << "erro " << erro << "\n";
+    }
+    return true;
+}
+
+bool Servidor::executa(const std::string &comando, const char *p, const char *fim,
+                       std::ostream &out, std::string &erro) {
+
+    const auto &grafo = projeto.grafo;
+    const auto &dinamico = execucao.escalonador();
+
+    std::string nome;
+    std::string valor;
+
+    // Nome de uma atividade (sem os extremos)
+    auto atividade = [&](AtvId &v) {
+        p = palavra(nome, p, fim);
+        v = grafo.busca(nome);
+        if (ATV_NULA == v || grafo.peso[v] < 0) {
+            erro = "atividade \"" + nome + "\" inexistente";
+            return false;
+        }
+        return true;
+    };
+
+    if ("duracao" == comando || "atrasa" == comando) {
+        AtvId v;
+        int dias;
+        if (!atividade(v)) return false;
+        p = palavra(valor, p, fim);
+        if (!inteiro(dias, valor)) {
+            erro = "uso: " + comando + " ATIVIDADE DIAS";
+            return false;
+        }
+
+        // Sem estouro na soma nem nas datas (até a duração prevista + dias)
+        const auto estimada = dinamico.duracaoEstimada(v);
+        if (("atrasa" == comando && dias > INT_MAX - estimada) ||
+            ("atrasa" == comando ? dias + estimada : dias) > INT_MAX - dinamico.duracao() - 1) {
+            erro = "duracao muito longa";
+            return false;
+        }
+        if ("atrasa" == comando) dias += estimada;
+
+        const auto antes = dinamico.duracao();
+        execucao.redefineDuracao(v, dias);
+
+        out << "duracao prevista: " << dinamico.duracao() << " (antes: " << antes << ")\n";
+        out << "recalculadas: " << dinamico.recalculadas() << "\n";
+        return true;
+    }
+
+    if ("dia" == comando) {
+        std::vector<struct Day> dias;
+        ErroParse erroParse;
+        p = pulaEspacos(p, fim);
+        rascunho.reinicia();
+        if (!parseExecucao(dias, rascunho, grafo, p, static_cast<size_t>(fim - p),
+                           0, erroParse)) {
+            erro = erroParse.mensagem;
+            return false;
+        }
+        if (1 != dias.size()) {
+            erro = "uso: dia N: {i:ATV;f:ATV}";
+            return false;
+        }
+        if (dias.front().dia < execucao.dia()) {
+            erro = "dia " + std::to_string(dias.front().dia) +
+                   " anterior ao ultimo aplicado (" + std::to_string(execucao.dia()) + ")";
+            return false;
+        }
+
+        const auto antes = dinamico.duracao();
+        execucao.processaDia(dias.front(), nullptr);
+
+        out << "duracao prevista: " << dinamico.duracao() << " (antes: " << antes << ")\n";
+        return true;
+    }
+
+    if ("atividade" == comando) {
+        AtvId v;
+        if (!atividade(v)) return false;
+
+        const auto e = dinamico.atividade(v);
+        out << nome << " peso=" << e.peso
+            << " iniciada=" << (e.iniciada ? "sim" : "nao")
+            << " finalizada=" << (e.finalizada ? "sim" : "nao")
+            << " ES=" << e.earlyStart << " EF=" << e.earlyFinish
+            << " LS=" << e.lateStart << " LF=" << e.lateFinish
+            << " SL=" << e.slack << "\n";
+        return true;
+    }
+
+    if ("criticas" == comando) {
+        const char *separador = "";
+        for (const auto v : execucao.atividades()) {
+            if (dinamico.considerada(v) && 0 == dinamico.slack(v)) {
+                out << separador << grafo.nomes[v];
+                separador = " ";
+            }
+        }
+        out << "\n";
+        return true;
+    }
+
+    if ("maiores" == comando) {
+        int k;
+        p = palavra(valor, p, fim);
+        if (!inteiro(k, valor) || k <= 0) {
+            erro = "uso: maiores K";
+            return false;
+        }
+
+        // Durações estimadas atuais (com as alterações da sessão)
+        std::vector<int> peso(grafo.peso);
+        for (const auto v : execucao.atividades()) {
+            peso[v] = dinamico.duracaoEstimada(v);
+        }
+
+        MaioresCaminhos maiores(grafo, peso);
+        std::vector<AtvId> caminho;
+        int duracao = 0;
+        int maior = 0;
+
+        for (int i = 0; i < k && maiores.proximo(caminho, duracao); ++i) {
+            if (0 == i) maior = duracao;
+            out << "duracao=" << duracao << " folga=" << maior - duracao << ":";
+            for (const auto v : caminho) out << " " << grafo.nomes[v];
+            out << "\n";
+        }
+        return true;
+    }
+
+    if ("atrasadas" == comando) {
+        std::vector<AtvId> atrasadas;
+        execucao.atrasadas(atrasadas);
+        const char *separador = "";
+        for (const auto v : atrasadas) {
+            out << separador << grafo.nomes[v];
+            separador = " ";
+        }
+        out << "\n";
+        return true;
+    }
+
+    if ("projeto" == comando) {
+        out << "atividades: " << execucao.atividades().size() << "\n";
+        out << "duracao critica: " << estatico.duracao << "\n";
+        out << "duracao prevista: " << dinamico.duracao() << "\n";
+        out << "ultimo dia: " << execucao.dia() << "\n";
+        return true;
+    }
+
+    if ("latencia" == comando) {
+        out << "consultas: " << consultas << "\n";
+        out << std::fixed << std::setprecision(1)
+            << "media: " << (consultas > 0 ? totalUs / consultas : 0.0) << "us\n"
+            << "maxima: " << maiorUs << "us\n";
+        return true;
+    }
+
+    erro = "consulta \"" + comando + "\" desconhecida";
+    return false;
+}
+
+void atendeFluxo(Servidor &servidor, std::istream &entrada, std::ostream &saida) {
+    std::string linha;
+    while (std::getline(entrada, linha)) {
+        if (!servidor.responde(linha, saida)) break;
+        saida.flush();
+    }
+}
+
+bool atendeSocket(Servidor &servidor, const std::string &caminho, std::string &erro) {
+#if defined (_WIN32)
+    (void) servidor;
+    (void) caminho;
+    erro = "socket Unix nao suportado nesta plataforma";
+    return false;
+#else
+    sockaddr_un endereco;
+    std::memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+
+    if (caminho.size() >= sizeof(endereco.sun_path)) {
+        erro = "caminho do socket muito longo: " + caminho;
+        return false;
+    }
+    std::memcpy(endereco.sun_path, caminho.c_str(), caminho.size() + 1);
+
+    const int escuta = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (escuta < 0) {
+        erro = "nao se pode criar o socket " + caminho;
+        return false;
+    }
+
+    unlink(caminho.c_str());
+
+    if (0 != bind(escuta, reinterpret_cast<sockaddr *>(&endereco), sizeof(endereco)) ||
+        0 != listen(escuta, 8)) {
+        close(escuta);
+        erro = "nao se pode abrir o socket " + caminho;
+        return false;
+    }
+
+    // Cliente que fecha a conexão não deve encerrar o servidor (SIGPIPE)
+#  if defined (MSG_NOSIGNAL)
+    const int flagsEnvio = MSG_NOSIGNAL;
+#  else
+    const int flagsEnvio = 0;
+#  endif
+
+    // SIGINT/SIGTERM interrompem accept/read (sem SA_RESTART) e encerram o laço
+    struct sigaction acao;
+    struct sigaction anteriorInt;
+    struct sigaction anteriorTerm;
+    std::memset(&acao, 0, sizeof(acao));
+    acao.sa_handler = registraSinal;
+    sigemptyset(&acao.sa_mask);
+    sinalRecebido = 0;
+    sigaction(SIGINT, &acao, &anteriorInt);
+    sigaction(SIGTERM, &acao, &anteriorTerm);
+
+    char buffer[1 << 12];
+
+    while (!sinalRecebido && !servidor.desligado()) {
+        const int conexao = accept(escuta, nullptr, nullptr);
+        if (conexao < 0) continue;
+
+        std::string pendente;
+        bool ativa = true;
+
+        while (ativa && !sinalRecebido) {
+            const auto lidos = read(conexao, buffer, sizeof(buffer));
+            if (lidos < 0 && EINTR == errno) continue;
+            if (lidos <= 0) break;
+            pendente.append(buffer, static_cast<size_t>(lidos));
+
+            // Uma resposta por linha completa
+            size_t inicio = 0;
+            size_t quebra;
+            std::ostringstream resposta;
+
+            while (ativa && (quebra = pendente.find('\n', inicio)) != std::string::npos) {
+                ativa = servidor.responde(pendente.substr(inicio, quebra - inicio), resposta);
+                inicio = quebra + 1;
+            }
+            pendente.erase(0, inicio);
+
+            const auto texto = resposta.str();
+            for (size_t enviados = 0; enviados < texto.size();) {
+                const auto n = send(conexao, texto.data() + enviados,
+                                    texto.size() - enviados, flagsEnvio);
+                if (n <= 0) {
+                    ativa = false;
+                    break;
+                }
+                enviados += static_cast<size_t>(n);
+            }
+        }
+
+        close(conexao);
+    }
+
+    sigaction(SIGINT, &anteriorInt, nullptr);
+    sigaction(SIGTERM, &anteriorTerm, nullptr);
+
+    close(escuta);
+    unlink(caminho.c_str());
+    return true;
+#endif
+}
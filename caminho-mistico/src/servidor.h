@@ -0,0 +1,92 @@
+/// Calculador de Caminho Critico
+/// Servidor de consultas: projeto carregado uma vez, consultas por linha
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_SERVIDOR_H
+#define CAMINHO_MISTICO_SERVIDOR_H
+
+#include <cstdint>      // uint64_t
+#include <istream>      // istream
+#include <ostream>      // ostream
+#include <string>       // string
+
+#include "cpm.h"        // Cronograma, MaioresCaminhos
+#include "arena.h"      // Arena
+#include "execucao.h"   // Execucao
+#include "parser.h"     // Projeto
+#include "relatorio.h"  // Opcoes
+
+/// Servidor de consultas "e se" sobre um projeto carregado
+///
+/// Cada consulta é uma linha; a resposta tem zero ou mais linhas de dados
+/// seguidas de uma linha "ok <latência>" ou "erro <mensagem>":
+///     duracao ATV N       nova duração estimada de ATV
+///     atrasa ATV N        duração estimada de ATV + N dias
+///     dia N: {i:A;f:B}    aplica os eventos de um dia (formato da 3a seção)
+///     atividade ATV       ES/EF/LS/LF/SL atuais de ATV
+///     criticas            atividades com folga zero, em ordem alfabética
+///     maiores K           os K caminhos mais longos (durações estimadas)
+///     atrasadas           atividades atrasadas até o último dia aplicado
+///     projeto             duração estática, duração prevista e último dia
+///     latencia            consultas atendidas, latência média e máxima
+///     sair                encerra a sessão
+///     desligar            encerra a sessão e o servidor (socket)
+/// As alterações são incrementais (Escalonador): somente a parte afetada
+/// do grafo é recalculada
+class Servidor {
+public:
+    /// Lê o projeto e calcula o cronograma estático
+    /// Os dias da terceira seção já presentes no arquivo são aplicados
+    /// @param arquivo caminho do arquivo
+    /// @param opcoes opções de leitura (cache e threads do cálculo)
+    /// @param erro descrição do erro (caso retorne false)
+    /// @return false em caso de erro
+    bool carrega(const std::string &arquivo, const Opcoes &opcoes, std::string &erro);
+
+    /// Responde uma consulta
+    /// @param consulta linha da consulta (sem '\n')
+    /// @param out saída da resposta
+    /// @return false caso a consulta encerre a sessão ("sair" ou "desligar")
+    bool responde(const std::string &consulta, std::ostream &out);
+
+    /// Recebeu "desligar": o servidor não aceita novas sessões
+    bool desligado() const { return desliga; }
+
+private:
+    bool executa(const std::string &comando, const char *p, const char *fim,
+                 std::ostream &out, std::string &erro);
+
+    Projeto projeto;
+    Cronograma estatico;
+    Execucao execucao;
+
+    /// Listas do dia de uma consulta "dia" (reiniciada a cada consulta: a
+    /// execução não guarda as listas depois de processaDia)
+    Arena rascunho;
+
+    bool desliga = false;
+    uint64_t consultas = 0;
+    double totalUs = 0;
+    double maiorUs = 0;
+};
+
+/// Atende consultas de um fluxo (stdin) até o fim da entrada ou "sair"
+/// @param servidor servidor carregado
+/// @param entrada consultas
+/// @param saida respostas
+void atendeFluxo(Servidor &servidor, std::istream &entrada, std::ostream &saida);
+
+/// Atende consultas em um socket Unix local, uma conexão por vez
+/// Cada conexão é uma sessão ("sair" encerra somente a conexão); retorna
+/// após "desligar" ou SIGINT/SIGTERM, removendo o arquivo do socket
+/// @param servidor servidor carregado
+/// @param caminho caminho do socket (recriado)
+/// @param erro descrição do erro (caso retorne false)
+/// @return false caso o socket não possa ser criado (ou não suportado)
+bool atendeSocket(Servidor &servidor, const std::string &caminho, std::string &erro);
+
+#endif // CAMINHO_MISTICO_SERVIDOR_H
@@ -0,0 +1,259 @@
+/// Calculador de Caminho Critico
+/// Simulação de Monte Carlo (PERT) do prazo do projeto
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "simulacao.h"
+
+#include <algorithm>    // max, nth_element, sort
+#include <atomic>       // atomic
+#include <cmath>        // sqrt
+#include <iomanip>      // setprecision
+#include <random>       // mt19937_64, seed_seq
+#include <thread>       // thread
+
+#include "cpm.h"        // ordenaTopologica, marcaCaminhos
+
+namespace {
+
+/// Amostras por bloco (cada bloco tem semente própria)
+const uint64_t AMOSTRAS_BLOCO = 1024;
+
+/// Percentis reportados
+const int PERCENTIS[] = {10, 25, 50, 75, 80, 90, 95, 99};
+
+/// Distribuição triangular de uma atividade (inversa da CDF)
+struct Triangular {
+    double otimista;
+    double pessimista;
+    double corte;       // CDF no valor mais provável
+    double esquerda;    // (p - o)(m - o)
+    double direita;     // (p - o)(p - m)
+
+    explicit Triangular(const TresPontos &t)
+            : otimista(t.otimista), pessimista(t.pessimista), corte(0),
+              esquerda(0), direita(0) {
+        const double amplitude = t.pessimista - t.otimista;
+        if (amplitude > 0) {
+            corte = (t.provavel - t.otimista) / amplitude;
+            esquerda = amplitude * (t.provavel - t.otimista);
+            direita = amplitude * (t.pessimista - t.provavel);
+        }
+    }
+
+    double sorteia(double u) const {
+        if (u < corte) return otimista + std::sqrt(u * esquerda);
+        return pessimista - std::sqrt((1 - u) * direita);
+    }
+};
+
+/// Grafo compacto: somente as atividades em algum caminho inicio -> fim,
+/// renumeradas na ordem topológica; vizinhos em CSR sobre as posições
+struct Compacto {
+    std::vector<AtvId> ids;
+    std::vector<Triangular> duracao;
+    std::vector<uint32_t> antInicio, antecessores;
+    std::vector<uint32_t> sucInicio, sucessores;
+    uint32_t fim = 0;
+};
+
+void compacta(Compacto &c, const Grafo &grafo) {
+
+    std::vector<AtvId> ordem;
+    std::vector<char> noCaminho;
+    ordenaTopologica(ordem, grafo);
+    marcaCaminhos(noCaminho, grafo, ordem);
+
+    const uint32_t FORA = static_cast<uint32_t>(-1);
+    std::vector<uint32_t> posicao(grafo.tamanho(), FORA);
+
+    for (const auto v : ordem) {
+        if (!noCaminho[v]) continue;
+        posicao[v] = static_cast<uint32_t>(c.ids.size());
+        c.ids.push_back(v);
+
+        TresPontos t;
+        if (!grafo.estimativa.empty()) {
+            t = grafo.estimativa[v];
+        } else if (grafo.peso[v] > 0) {
+            t.otimista = t.provavel = t.pessimista = grafo.peso[v];
+        }
+        c.duracao.push_back(Triangular(t));
+    }
+    c.fim = posicao[grafo.fim];
+
+    // Mesmas regras de calculaCPM: o inicio não tem antecessoras e o fim
+    // não tem sucessoras
+    c.antInicio.push_back(0);
+    c.sucInicio.push_back(0);
+    for (const auto v : c.ids) {
+        if (v != grafo.inicio) {
+            for (auto a = grafo.antBegin(v); a != grafo.antEnd(v); ++a) {
+                if (posicao[*a] != FORA && *a != grafo.fim) c.antecessores.push_back(posicao[*a]);
+            }
+        }
+        if (v != grafo.fim) {
+            for (auto s = grafo.sucBegin(v); s != grafo.sucEnd(v); ++s) {
+                if (posicao[*s] != FORA) c.sucessores.push_back(posicao[*s]);
+            }
+        }
+        c.antInicio.push_back(static_cast<uint32_t>(c.antecessores.size()));
+        c.sucInicio.push_back(static_cast<uint32_t>(c.sucessores.size()));
+    }
+}
+
+} // namespace
+
+void simulaProjeto(ResultadoSimulacao &resultado, const Grafo &grafo,
+                   const ParametrosSimulacao &parametros) {
+
+    resultado = ResultadoSimulacao();
+    resultado.criticidade.assign(grafo.tamanho(), 0.0);
+
+    if (grafo.inicio == ATV_NULA || grafo.fim == ATV_NULA || 0 == parametros.amostras) {
+        return;
+    }
+
+    Compacto c;
+    compacta(c, grafo);
+
+    const auto n = c.ids.size();
+    const auto amostras = std::min(parametros.amostras, MAX_AMOSTRAS);
+    const auto blocos = (amostras + AMOSTRAS_BLOCO - 1) / AMOSTRAS_BLOCO;
+
+    unsigned threads = parametros.threads;
+    if (0 == threads) {
+        threads = std::thread::hardware_concurrency();
+        if (0 == threads) threads = 1;
+    }
+    threads = static_cast<unsigned>(std::min<uint64_t>(threads, blocos));
+
+    // Cada amostra tem posição própria: escrita sem travas
+    std::vector<float> duracoes(amostras);
+    std::vector<std::vector<uint64_t>> criticas(threads);
+    std::atomic<uint64_t> proximo(0);
+
+    auto trabalhador = [&](unsigned t) {
+        std::vector<uint64_t> &contagem = criticas[t];
+        contagem.assign(n, 0);
+
+        std::vector<double> d(n), ef(n), cauda(n);
+
+        for (uint64_t b = proximo++; b < blocos; b = proximo++) {
+            std::seed_seq seq{static_cast<uint32_t>(parametros.semente),
+                              static_cast<uint32_t>(parametros.semente >> 32),
+                              static_cast<uint32_t>(b), static_cast<uint32_t>(b >> 32)};
+            std::mt19937_64 rng(seq);
+
+            const auto fimBloco = std::min(amostras, (b + 1) * AMOSTRAS_BLOCO);
+
+            for (uint64_t a = b * AMOSTRAS_BLOCO; a < fimBloco; ++a) {
+                // Ida: EF = maior EF das antecessoras + duração sorteada
+                for (size_t k = 0; k < n; ++k) {
+                    const double u = (rng() >> 11) * (1.0 / 9007199254740992.0);
+                    d[k] = c.duracao[k].sorteia(u);
+
+                    double es = 0;
+                    for (auto i = c.antInicio[k]; i < c.antInicio[k + 1]; ++i) {
+                        es = std::max(es, ef[c.antecessores[i]]);
+                    }
+                    ef[k] = es + d[k];
+                }
+
+                const double total = ef[c.fim];
+                const double tolerancia = 1e-9 * std::max(1.0, total);
+
+                // Volta: crítica quando ES + cauda == duração do projeto
+                for (size_t k = n; k-- > 0;) {
+                    double maior = 0;
+                    for (auto i = c.sucInicio[k]; i < c.sucInicio[k + 1]; ++i) {
+                        maior = std::max(maior, cauda[c.sucessores[i]]);
+                    }
+                    cauda[k] = d[k] + maior;
+
+                    if (ef[k] - d[k] + cauda[k] >= total - tolerancia) ++contagem[k];
+                }
+
+                duracoes[a] = static_cast<float>(total);
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t) {
+        pool.push_back(std::thread(trabalhador, t));
+    }
+    trabalhador(0);
+    for (auto &t : pool) {
+        t.join();
+    }
+
+    // Criticidade: soma dos acumuladores de cada thread
+    for (size_t k = 0; k < n; ++k) {
+        uint64_t soma = 0;
+        for (const auto &contagem : criticas) soma += contagem[k];
+        resultado.criticidade[c.ids[k]] = static_cast<double>(soma) / amostras;
+    }
+
+    // Estatísticas na ordem das amostras (independe das threads)
+    double soma = 0, somaQuadrados = 0;
+    for (const auto x : duracoes) {
+        soma += x;
+        somaQuadrados += static_cast<double>(x) * x;
+    }
+
+    resultado.amostras = amostras;
+    resultado.media = soma / amostras;
+    resultado.desvio = std::sqrt(std::max(0.0, somaQuadrados / amostras -
+                                               resultado.media * resultado.media));
+
+    // Percentis (nth_element progressivo: cada um reduz o intervalo seguinte)
+    auto de = duracoes.begin();
+    for (const auto p : PERCENTIS) {
+        const auto indice = std::min<uint64_t>(amostras - 1, (amostras * p) / 100);
+        const auto it = duracoes.begin() + static_cast<std::ptrdiff_t>(indice);
+        std::nth_element(de, it, duracoes.end());
+        resultado.percentis.push_back(std::make_pair(p, static_cast<double>(*it)));
+        de = it;
+    }
+
+    resultado.minimo = *std::min_element(duracoes.begin(), duracoes.end());
+    resultado.maximo = *std::max_element(duracoes.begin(), duracoes.end());
+}
+
+void printSimulacao(std::ostream &out, const Grafo &grafo,
+                    const ResultadoSimulacao &resultado) {
+
+    const auto precisao = out.precision();
+    const auto formato = out.flags();
+
+    out << std::fixed << std::setprecision(2);
+
+    out << "SIMULACAO (Monte Carlo, " << resultado.amostras << " amostras)\n--------------\n";
+    out << "Duracao media: " << resultado.media << "  Desvio: " << resultado.desvio << "\n";
+    out << "Minima: " << resultado.minimo << "  Maxima: " << resultado.maximo << "\n";
+
+    for (const auto &p : resultado.percentis) {
+        out << "P" << p.first << ": " << p.second << "\n";
+    }
+
+    // Índice de criticidade das atividades (sem os extremos)
+    std::vector<AtvId> porNome;
+    for (AtvId v = 0; v < grafo.tamanho(); ++v) {
+        if (grafo.peso[v] != -1) porNome.push_back(v);
+    }
+    std::sort(porNome.begin(), porNome.end(),
+              [&grafo](AtvId a, AtvId b) { return grafo.nomes[a] < grafo.nomes[b]; });
+
+    out << "Indice de criticidade:\n";
+    for (const auto v : porNome) {
+        out << "\t" << grafo.nomes[v] << ": " << 100 * resultado.criticidade[v] << "%\n";
+    }
+    out << "--------------\n\n";
+
+    out.flags(formato);
+    out.precision(precisao);
+}
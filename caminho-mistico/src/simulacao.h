@@ -0,0 +1,67 @@
+/// Calculador de Caminho Critico
+/// Simulação de Monte Carlo (PERT) do prazo do projeto
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_SIMULACAO_H
+#define CAMINHO_MISTICO_SIMULACAO_H
+
+#include <cstdint>      // uint64_t
+#include <ostream>      // ostream
+#include <vector>       // vector
+
+#include "grafo.h"      // Grafo, TresPontos
+
+/// Limite de amostras de uma simulação (4 bytes cada: 128 MiB), muito além
+/// do necessário para estabilizar os percentis
+const uint64_t MAX_AMOSTRAS = uint64_t(1) << 25;
+
+/// Parâmetros da simulação
+struct ParametrosSimulacao {
+    uint64_t amostras = 100000;
+    /// Quantidade de threads (0: núcleos disponíveis)
+    unsigned threads = 0;
+    uint64_t semente = 1;
+};
+
+/// Distribuição da duração do projeto e índice de criticidade
+struct ResultadoSimulacao {
+    uint64_t amostras = 0;
+    double media = 0;
+    double desvio = 0;
+    double minimo = 0;
+    double maximo = 0;
+    /// {percentil, duração}: P10, P25, P50, P75, P80, P90, P95, P99
+    std::vector<std::pair<int, double>> percentis;
+    /// Fração das amostras em que cada atividade foi crítica (por id)
+    std::vector<double> criticidade;
+};
+
+/// Simula o projeto sorteando a duração de cada atividade de uma
+/// distribuição triangular (otimista, provável, pessimista)
+///     - cada amostra é uma passagem de ida e volta direta sobre o grafo
+///       (sem enumerar caminhos), somente com as atividades em algum
+///       caminho inicio -> fim
+///     - as amostras são divididas em blocos com semente própria: o
+///       resultado não depende da quantidade de threads
+///     - cada thread acumula em memória própria (sem travas); os
+///       acumuladores são somados ao final
+/// Atividades sem estimativa de três pontos usam a duração fixa
+/// @param resultado distribuição simulada (amostras: as usadas, no máximo
+///        MAX_AMOSTRAS)
+/// @param grafo grafo de dependências validado
+/// @param parametros amostras, threads e semente
+void simulaProjeto(ResultadoSimulacao &resultado, const Grafo &grafo,
+                   const ParametrosSimulacao &parametros);
+
+/// Escreve a distribuição e a criticidade das atividades (em ordem alfabética)
+/// @param out saída
+/// @param grafo grafo de dependências
+/// @param resultado resultado da simulação
+void printSimulacao(std::ostream &out, const Grafo &grafo,
+                    const ResultadoSimulacao &resultado);
+
+#endif // CAMINHO_MISTICO_SIMULACAO_H
@@ -0,0 +1,157 @@
+/// Calculador de Caminho Critico
+/// Validação estrutural do grafo de dependências
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include "validacao.h"
+
+#include <algorithm>    // reverse
+
+#include "cpm.h"        // ordenaTopologica
+
+namespace {
+
+/// Máximo de atividades listadas por tipo de problema
+const size_t MAX_LISTADAS = 10;
+
+/// Extrai um ciclo dentre as atividades que sobraram da ordenação
+/// topológica: cada uma tem ao menos uma antecessora que também sobrou,
+/// então subir pelas antecessoras sempre repete uma atividade
+void extraiCiclo(std::vector<AtvId> &ciclo, const Grafo &grafo,
+                 const std::vector<AtvId> &ordem) {
+
+    const auto n = grafo.tamanho();
+
+    std::vector<char> ordenada(n, 0);
+    for (const auto v : ordem) ordenada[v] = 1;
+
+    AtvId v = 0;
+    while (v < n && ordenada[v]) ++v;
+    if (v == n) return;
+
+    // Sobe até repetir: posição de cada atividade no percurso
+    std::vector<uint32_t> visita(n, static_cast<uint32_t>(-1));
+    std::vector<AtvId> percurso;
+
+    while (visita[v] == static_cast<uint32_t>(-1)) {
+        visita[v] = static_cast<uint32_t>(percurso.size());
+        percurso.push_back(v);
+
+        for (auto a = grafo.antBegin(v); a != grafo.antEnd(v); ++a) {
+            if (!ordenada[*a]) {
+                v = *a;
+                break;
+            }
+        }
+    }
+
+    // Percurso pelas antecessoras: inverte para a ordem das conexões
+    ciclo.assign(percurso.begin() + visita[v], percurso.end());
+    std::reverse(ciclo.begin(), ciclo.end());
+}
+
+/// Busca em largura a partir de uma atividade
+/// @param marcados atividades alcançadas
+/// @param origem atividade de partida
+/// @param barreira atividade que não é expandida
+/// @param direta true: pelos sucessores; false: pelos antecessores
+void alcanca(std::vector<char> &marcados, const Grafo &grafo,
+             AtvId origem, AtvId barreira, bool direta) {
+
+    marcados.assign(grafo.tamanho(), 0);
+    std::vector<AtvId> fila(1, origem);
+    marcados[origem] = 1;
+
+    for (size_t i = 0; i < fila.size(); ++i) {
+        const auto v = fila[i];
+        if (v == barreira) continue;
+
+        const auto b = direta ? grafo.sucBegin(v) : grafo.antBegin(v);
+        const auto e = direta ? grafo.sucEnd(v) : grafo.antEnd(v);
+        for (auto s = b; s != e; ++s) {
+            if (!marcados[*s]) {
+                marcados[*s] = 1;
+                fila.push_back(*s);
+            }
+        }
+    }
+}
+
+/// Acrescenta uma lista de nomes (limitada a MAX_LISTADAS)
+void listaNomes(std::string &texto, const std::vector<AtvId> &lista,
+                const Grafo &grafo, const char *separador) {
+    for (size_t i = 0; i < lista.size() && i < MAX_LISTADAS; ++i) {
+        if (0 != i) texto += separador;
+        texto += grafo.nomes[lista[i]];
+    }
+    if (lista.size() > MAX_LISTADAS) {
+        texto += " (+" + std::to_string(lista.size() - MAX_LISTADAS) + ")";
+    }
+}
+
+} // namespace
+
+bool validaGrafo(Validacao &validacao, const Grafo &grafo) {
+
+    validacao = Validacao();
+
+    std::vector<AtvId> ordem;
+    if (!ordenaTopologica(ordem, grafo)) {
+        extraiCiclo(validacao.ciclo, grafo, ordem);
+    }
+
+    if (grafo.inicio == ATV_NULA || grafo.fim == ATV_NULA) {
+        validacao.semExtremos = true;
+        return false;
+    }
+
+    // Buscas valem também com ciclos: todos os problemas de uma vez
+    std::vector<char> doInicio, ateFim;
+    alcanca(doInicio, grafo, grafo.inicio, grafo.fim, true);
+    alcanca(ateFim, grafo, grafo.fim, grafo.inicio, false);
+
+    for (AtvId v = 0; v < grafo.tamanho(); ++v) {
+        if (!doInicio[v]) validacao.inalcancaveis.push_back(v);
+        else if (!ateFim[v]) validacao.semSaida.push_back(v);
+    }
+
+    return validacao.valido();
+}
+
+std::string descreveValidacao(const Validacao &validacao, const Grafo &grafo) {
+
+    std::string texto;
+
+    auto linha = [&texto]() { if (!texto.empty()) texto += "\n"; };
+
+    if (validacao.semExtremos) {
+        linha();
+        texto += "cabecalho sem inicio e fim (duracao -1)";
+    }
+
+    if (!validacao.ciclo.empty()) {
+        linha();
+        texto += "ciclo na secao de conexoes: ";
+        listaNomes(texto, validacao.ciclo, grafo, " -> ");
+        if (validacao.ciclo.size() <= MAX_LISTADAS) {
+            texto += " -> " + grafo.nomes[validacao.ciclo.front()];
+        }
+    }
+
+    if (!validacao.inalcancaveis.empty()) {
+        linha();
+        texto += "atividade(s) sem caminho a partir de " + grafo.nomes[grafo.inicio] + ": ";
+        listaNomes(texto, validacao.inalcancaveis, grafo, ", ");
+    }
+
+    if (!validacao.semSaida.empty()) {
+        linha();
+        texto += "atividade(s) sem caminho ate " + grafo.nomes[grafo.fim] + ": ";
+        listaNomes(texto, validacao.semSaida, grafo, ", ");
+    }
+
+    return texto;
+}
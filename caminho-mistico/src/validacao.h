@@ -0,0 +1,46 @@
+/// Calculador de Caminho Critico
+/// Validação estrutural do grafo de dependências
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#ifndef CAMINHO_MISTICO_VALIDACAO_H
+#define CAMINHO_MISTICO_VALIDACAO_H
+
+#include <string>       // string
+#include <vector>       // vector
+
+#include "grafo.h"      // Grafo, AtvId
+
+/// Problemas estruturais encontrados no grafo
+struct Validacao {
+    /// true caso o cabeçalho não tenha inicio e fim (peso -1)
+    bool semExtremos = false;
+    /// Um ciclo, na ordem das conexões (a primeira atividade não é repetida)
+    std::vector<AtvId> ciclo;
+    /// Atividades sem caminho a partir do inicio
+    std::vector<AtvId> inalcancaveis;
+    /// Atividades sem caminho até o fim
+    std::vector<AtvId> semSaida;
+
+    bool valido() const {
+        return !semExtremos && ciclo.empty() && inalcancaveis.empty() && semSaida.empty();
+    }
+};
+
+/// Valida o grafo em O(V+E): extremos, ciclos (ordenação topológica),
+/// atividades inalcançáveis e sem saída (buscas a partir do inicio e do fim)
+/// @param validacao problemas encontrados
+/// @param grafo grafo de dependências
+/// @return false caso haja algum problema
+bool validaGrafo(Validacao &validacao, const Grafo &grafo);
+
+/// Descreve os problemas encontrados (uma linha por tipo de problema)
+/// @param validacao problemas encontrados
+/// @param grafo grafo de dependências
+/// @return descrição (vazia caso o grafo seja válido)
+std::string descreveValidacao(const Validacao &validacao, const Grafo &grafo);
+
+#endif // CAMINHO_MISTICO_VALIDACAO_H
@@ -0,0 +1,144 @@
+/// Calculador de Caminho Critico
+/// Teste: arena com blocos absorvidos, reiniciada e reaproveitada
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include <cstdint>      // uintptr_t
+#include <cstdlib>      // EXIT_SUCCESS, EXIT_FAILURE
+#include <cstring>      // memset
+#include <iostream>     // cout, cerr
+#include <string>       // string
+#include <vector>       // vector
+
+#include "arena.h"      // Arena
+
+namespace {
+
+/// Falhas encontradas (cada uma descrita em stderr)
+int falhas = 0;
+
+void confere(bool condicao, const std::string &caso, const std::string &descricao) {
+    if (condicao) return;
+    ++falhas;
+    std::cerr << "FALHA [" << caso << "]: " << descricao << "\n";
+}
+
+/// Primeiro bloco de uma arena nova (ver Arena::aloca)
+const size_t PRIMEIRO_BLOCO = 4096;
+
+/// Preenche n bytes alocados com um valor conhecido
+char *preenche(Arena &arena, size_t n, char valor) {
+    auto p = static_cast<char *>(arena.aloca(n, 1));
+    std::memset(p, valor, n);
+    return p;
+}
+
+bool intacto(const char *p, size_t n, char valor) {
+    for (size_t i = 0; i < n; ++i) {
+        if (p[i] != valor) return false;
+    }
+    return true;
+}
+
+/// Depois de reinicia, o bloco atual inteiro (e somente ele) é reaproveitado:
+/// as alocações cabem nele sem novos blocos e sem sair dos seus limites
+void confereReinicio(const std::string &caso, Arena &arena, size_t esperado) {
+    confere(arena.capacidade() == esperado, caso,
+            "capacidade " + std::to_string(arena.capacidade()) + " apos reinicia, esperada " +
+            std::to_string(esperado));
+
+    const size_t PEDACO = 64;
+    std::vector<char *> pedacos;
+    for (size_t usado = 0; usado + PEDACO <= esperado; usado += PEDACO) {
+        pedacos.push_back(preenche(arena, PEDACO, static_cast<char>(pedacos.size())));
+    }
+    confere(arena.capacidade() == esperado, caso, "novo bloco antes de esgotar o atual");
+
+    const auto base = reinterpret_cast<uintptr_t>(pedacos.front());
+    for (size_t i = 0; i < pedacos.size(); ++i) {
+        const auto p = reinterpret_cast<uintptr_t>(pedacos[i]);
+        confere(p >= base && p + PEDACO <= base + esperado, caso, "alocacao fora do bloco atual");
+        confere(intacto(pedacos[i], PEDACO, static_cast<char>(i)), caso, "alocacoes sobrepostas");
+    }
+
+    // O bloco esgotado dá lugar a um novo
+    preenche(arena, PEDACO, 'x');
+    confere(arena.capacidade() > esperado, caso, "bloco esgotado sem novo bloco");
+}
+
+} // namespace
+
+int main() {
+
+    // Bloco atual em uso, blocos absorvidos de outra arena, reinicia e aloca
+    {
+        const std::string caso = "absorve, reinicia, aloca";
+        Arena destino;
+        Arena origem;
+
+        preenche(destino, 100, 'd');
+
+        std::vector<char *> absorvidos;
+        for (int i = 0; i < 6; ++i) absorvidos.push_back(preenche(origem, 3000, 'o'));
+        const auto totalOrigem = origem.capacidade();
+
+        destino.absorve(origem);
+        confere(0 == origem.capacidade(), caso, "origem nao ficou vazia");
+        confere(destino.capacidade() == PRIMEIRO_BLOCO + totalOrigem, caso,
+                "capacidade apos absorve");
+
+        // O bloco atual continua o do destino: pequenas alocações não crescem
+        preenche(destino, 200, 'e');
+        confere(destino.capacidade() == PRIMEIRO_BLOCO + totalOrigem, caso,
+                "bloco atual trocado por absorve");
+
+        for (const auto p : absorvidos) {
+            confere(intacto(p, 3000, 'o'), caso, "blocos absorvidos alterados");
+        }
+
+        destino.reinicia();
+        confereReinicio(caso, destino, PRIMEIRO_BLOCO);
+    }
+
+    // Absorve em uma arena sem bloco atual: reinicia a deixa vazia
+    {
+        const std::string caso = "absorve em arena vazia";
+        Arena destino;
+        Arena origem;
+
+        const auto p = preenche(origem, 500, 'o');
+        destino.absorve(origem);
+        confere(intacto(p, 500, 'o'), caso, "bloco absorvido alterado");
+
+        destino.reinicia();
+        confere(0 == destino.capacidade(), caso, "capacidade apos reinicia");
+
+        preenche(destino, 10, 'n');
+        destino.reinicia();
+        confereReinicio(caso, destino, PRIMEIRO_BLOCO);
+    }
+
+    // Reinícios seguidos (consultas "dia" do servidor), cada um com absorve
+    {
+        const std::string caso = "reinicios seguidos";
+        Arena rascunho;
+        preenche(rascunho, 1, 'r');
+
+        for (int i = 0; i < 4; ++i) {
+            Arena trecho;
+            preenche(trecho, 5000, 't');
+            rascunho.absorve(trecho);
+            rascunho.reinicia();
+            confere(rascunho.capacidade() == PRIMEIRO_BLOCO, caso, "capacidade apos reinicia");
+            preenche(rascunho, PRIMEIRO_BLOCO, 'r');
+            confere(rascunho.capacidade() == PRIMEIRO_BLOCO, caso, "bloco atual nao reaproveitado");
+            rascunho.reinicia();
+        }
+    }
+
+    std::cout << "arena: " << falhas << " falha(s)\n";
+    return 0 == falhas ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,280 @@
+/// Calculador de Caminho Critico
+/// Teste: caminhos críticos e mais longos conferidos com a enumeração completa
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include <algorithm>    // max, sort
+#include <cstdint>      // UINT64_MAX
+#include <cstdlib>      // EXIT_SUCCESS, EXIT_FAILURE
+#include <functional>   // greater
+#include <iostream>     // cout, cerr
+#include <random>       // mt19937_64
+#include <set>          // set
+#include <sstream>      // ostringstream
+#include <string>       // string
+#include <vector>       // vector
+
+#include "cpm.h"        // calculaCPM, CaminhosCriticos, MaioresCaminhos
+#include "gerador.h"    // geraProjeto
+#include "parser.h"     // parseProjeto
+
+namespace {
+
+/// Falhas encontradas (cada uma descrita em stderr)
+int falhas = 0;
+
+void confere(bool condicao, const std::string &caso, const std::string &descricao) {
+    if (condicao) return;
+    ++falhas;
+    std::cerr << "FALHA [" << caso << "]: " << descricao << "\n";
+}
+
+/// Caminho inicio -> fim e a soma das durações (negativas contam zero)
+struct Caminho {
+    std::vector<AtvId> atividades;
+    int duracao;
+};
+
+/// Enumera todos os caminhos inicio -> fim (busca em profundidade)
+void enumera(std::vector<Caminho> &caminhos, const Grafo &grafo, const std::vector<int> &peso,
+             AtvId v, std::vector<AtvId> &pilha, int soma) {
+    pilha.push_back(v);
+    soma += std::max(0, peso[v]);
+
+    if (v == grafo.fim) {
+        caminhos.push_back(Caminho{pilha, soma});
+    } else {
+        for (auto s = grafo.sucBegin(v); s != grafo.sucEnd(v); ++s) {
+            enumera(caminhos, grafo, peso, *s, pilha, soma);
+        }
+    }
+
+    pilha.pop_back();
+}
+
+/// Caminho formado por conexões do grafo, do inicio ao fim
+bool valido(const std::vector<AtvId> &caminho, const Grafo &grafo) {
+    if (caminho.empty() || caminho.front() != grafo.inicio || caminho.back() != grafo.fim) {
+        return false;
+    }
+    for (size_t i = 0; i + 1 < caminho.size(); ++i) {
+        if (std::find(grafo.sucBegin(caminho[i]), grafo.sucEnd(caminho[i]), caminho[i + 1]) ==
+            grafo.sucEnd(caminho[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int soma(const std::vector<AtvId> &caminho, const std::vector<int> &peso) {
+    int total = 0;
+    for (const auto v : caminho) total += std::max(0, peso[v]);
+    return total;
+}
+
+/// Extrai todos os caminhos (k maior que a quantidade) e confere com a
+/// enumeração: mesma quantidade, durações em ordem decrescente e iguais às
+/// somas, caminhos distintos e válidos
+void testaMaiores(const std::string &caso, const Grafo &grafo, const std::vector<int> &peso) {
+
+    std::vector<Caminho> todos;
+    std::vector<AtvId> pilha;
+    enumera(todos, grafo, peso, grafo.inicio, pilha, 0);
+
+    std::vector<int> esperadas;
+    for (const auto &c : todos) esperadas.push_back(c.duracao);
+    std::sort(esperadas.begin(), esperadas.end(), std::greater<int>());
+
+    MaioresCaminhos maiores(grafo, peso);
+    std::set<std::vector<AtvId>> vistos;
+    std::vector<int> duracoes;
+    std::vector<AtvId> caminho;
+    int duracao = 0;
+
+    const size_t k = todos.size() + 3;
+    for (size_t i = 0; i < k && maiores.proximo(caminho, duracao); ++i) {
+        confere(valido(caminho, grafo), caso, "caminho invalido");
+        confere(duracao == soma(caminho, peso), caso, "duracao diferente da soma do caminho");
+        confere(vistos.insert(caminho).second, caso, "caminho repetido");
+        duracoes.push_back(duracao);
+    }
+
+    confere(!maiores.proximo(caminho, duracao), caso, "caminho alem dos existentes");
+    confere(duracoes == esperadas, caso,
+            "duracoes " + std::to_string(duracoes.size()) + " caminho(s) diferentes da enumeracao (" +
+            std::to_string(esperadas.size()) + ")");
+}
+
+/// Caminhos críticos conferidos com a enumeração: a quantidade e o conjunto
+/// extraído são exatamente os caminhos de duração máxima
+void testaCriticos(const std::string &caso, const Grafo &grafo) {
+
+    Cronograma cronograma;
+    if (!calculaCPM(cronograma, grafo)) {
+        confere(false, caso, "calculaCPM falhou");
+        return;
+    }
+
+    std::vector<Caminho> todos;
+    std::vector<AtvId> pilha;
+    enumera(todos, grafo, grafo.peso, grafo.inicio, pilha, 0);
+
+    int maior = 0;
+    for (const auto &c : todos) maior = std::max(maior, c.duracao);
+    confere(cronograma.duracao == maior, caso, "duracao diferente do maior caminho");
+
+    std::set<std::vector<AtvId>> esperados;
+    for (const auto &c : todos) {
+        if (c.duracao == maior) esperados.insert(c.atividades);
+    }
+
+    CaminhosCriticos criticos(grafo, cronograma);
+    confere(!criticos.saturada(), caso, "quantidade saturada em grafo pequeno");
+    confere(criticos.quantidade() == esperados.size(), caso,
+            "quantidade " + std::to_string(criticos.quantidade()) + " diferente da enumeracao (" +
+            std::to_string(esperados.size()) + ")");
+
+    std::set<std::vector<AtvId>> extraidos;
+    std::vector<AtvId> caminho;
+    while (extraidos.size() <= esperados.size() && criticos.proximo(caminho)) {
+        confere(extraidos.insert(caminho).second, caso, "caminho critico repetido");
+    }
+    confere(extraidos == esperados, caso, "caminhos extraidos diferentes da enumeracao");
+}
+
+/// Lê um projeto a partir do texto
+bool leProjeto(Projeto &projeto, const std::string &arquivo) {
+    ErroParse erro;
+    if (!parseProjeto(projeto, arquivo.data(), arquivo.size(), erro)) {
+        std::cerr << "ERRO: projeto de teste invalido: linha " << erro.linha << ": "
+                  << erro.mensagem << "\n";
+        return false;
+    }
+    return true;
+}
+
+/// Projeto gerado (pequeno: a enumeração é completa)
+bool geraGrafo(Projeto &projeto, const ParametrosGerador &parametros) {
+    std::ostringstream texto;
+    geraProjeto(texto, parametros);
+    return leProjeto(projeto, texto.str());
+}
+
+/// Losangos em série: camadas de duas atividades, cada uma ligada às duas da
+/// camada seguinte; todas com o mesmo peso, logo 2^camadas caminhos críticos
+bool diamante(Projeto &projeto, int camadas) {
+    std::ostringstream texto;
+    texto << "#\n{{INICIO,-1}";
+    for (int c = 0; c < camadas; ++c) texto << ",{A" << c << ",1},{B" << c << ",1}";
+    texto << ",{FIM,-1}}\n#\n";
+
+    texto << "{INICIO,A0}\n{INICIO,B0}\n";
+    for (int c = 0; c + 1 < camadas; ++c) {
+        for (const char de : {'A', 'B'}) {
+            texto << "{" << de << c << ",A" << c + 1 << "}\n";
+            texto << "{" << de << c << ",B" << c + 1 << "}\n";
+        }
+    }
+    texto << "{A" << camadas - 1 << ",FIM}\n{B" << camadas - 1 << ",FIM}\n#\n";
+
+    return leProjeto(projeto, texto.str());
+}
+
+/// Contagem na borda de uint64_t: 63 camadas cabem (2^63), 64 saturam; a
+/// extração continua sob demanda mesmo com a contagem saturada
+bool testaSaturacao() {
+    const int camadasTeste[] = {63, 64};
+
+    for (const auto camadas : camadasTeste) {
+        const std::string caso = "diamante " + std::to_string(camadas);
+
+        Projeto projeto;
+        if (!diamante(projeto, camadas)) return false;
+        const auto &grafo = projeto.grafo;
+
+        Cronograma cronograma;
+        if (!calculaCPM(cronograma, grafo)) {
+            confere(false, caso, "calculaCPM falhou");
+            continue;
+        }
+        confere(cronograma.duracao == camadas, caso, "duracao diferente do numero de camadas");
+
+        CaminhosCriticos criticos(grafo, cronograma);
+        if (64 == camadas) {
+            confere(criticos.saturada(), caso, "quantidade deveria saturar");
+            confere(criticos.quantidade() == UINT64_MAX, caso, "saturacao deveria ser UINT64_MAX");
+        } else {
+            confere(!criticos.saturada(), caso, "quantidade nao deveria saturar");
+            confere(criticos.quantidade() == (uint64_t(1) << 63), caso, "quantidade deveria ser 2^63");
+        }
+
+        std::set<std::vector<AtvId>> extraidos;
+        std::vector<AtvId> caminho;
+        for (int i = 0; i < 1000; ++i) {
+            if (!criticos.proximo(caminho)) {
+                confere(false, caso, "extracao terminou antes de 1000 caminhos");
+                break;
+            }
+            confere(valido(caminho, grafo), caso, "caminho invalido");
+            confere(soma(caminho, grafo.peso) == camadas, caso, "caminho nao critico");
+            confere(extraidos.insert(caminho).second, caso, "caminho critico repetido");
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+
+    const Forma formas[] = {Forma::Cadeia, Forma::Leque, Forma::Camadas, Forma::SerieParalelo};
+    const char *nomesFormas[] = {"cadeia", "leque", "camadas", "serie-paralelo"};
+    const double densidades[] = {0.0, 0.5, 1.5};
+
+    std::mt19937_64 sorteio(7);
+    size_t casos = 0;
+
+    for (size_t f = 0; f < 4; ++f) {
+        for (const auto densidade : densidades) {
+            for (uint32_t n = 1; n <= 12; ++n) {
+                for (uint64_t semente = 1; semente <= 3; ++semente) {
+                    ParametrosGerador parametros;
+                    parametros.atividades = n;
+                    parametros.densidade = densidade;
+                    parametros.forma = formas[f];
+                    parametros.duracaoMaxima = static_cast<int>(semente); // 1: todos empatados
+                    parametros.semente = semente;
+
+                    Projeto projeto;
+                    if (!geraGrafo(projeto, parametros)) return EXIT_FAILURE;
+                    const auto &grafo = projeto.grafo;
+
+                    std::ostringstream caso;
+                    caso << nomesFormas[f] << " n=" << n << " d=" << densidade << " s=" << semente;
+
+                    // Durações do cabeçalho
+                    testaMaiores(caso.str(), grafo, grafo.peso);
+                    testaCriticos(caso.str(), grafo);
+
+                    // Durações sorteadas, com zeros e negativas (contam zero)
+                    std::vector<int> peso(grafo.peso);
+                    for (AtvId v = 0; v < grafo.tamanho(); ++v) {
+                        if (peso[v] >= 0) peso[v] = static_cast<int>(sorteio() % 5) - 1;
+                    }
+                    testaMaiores(caso.str() + " (pesos sorteados)", grafo, peso);
+
+                    casos += 3;
+                }
+            }
+        }
+    }
+
+    if (!testaSaturacao()) return EXIT_FAILURE;
+    casos += 2;
+
+    std::cout << "caminhos: " << casos << " caso(s), " << falhas << " falha(s)\n";
+    return 0 == falhas ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,157 @@
+/// Calculador de Caminho Critico
+/// Teste: lote de cenários (AVX2, SSE4.1 e escalar) conferido com calculaCPM
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include <algorithm>    // max
+#include <cstdlib>      // EXIT_SUCCESS, EXIT_FAILURE
+#include <iostream>     // cout, cerr
+#include <random>       // mt19937_64
+#include <sstream>      // ostringstream
+#include <string>       // string
+#include <vector>       // vector
+
+#include "cenarios.h"   // calculaCenarios, usaInstrucoesCenarios
+#include "cpm.h"        // calculaCPM
+#include "gerador.h"    // geraProjeto
+#include "parser.h"     // parseProjeto
+
+namespace {
+
+/// Falhas encontradas (somente as primeiras são descritas em stderr)
+int falhas = 0;
+
+void confere(bool condicao, const std::string &caso, const std::string &descricao) {
+    if (condicao) return;
+    if (++falhas <= 20) std::cerr << "FALHA [" << caso << "]: " << descricao << "\n";
+}
+
+/// Tamanhos de lote: múltiplos e não múltiplos de 4 (SSE4.1) e 8 (AVX2)
+const size_t TAMANHOS_LOTE[] = {1, 2, 3, 4, 5, 7, 8, 9, 12, 15, 16, 17, 31, 33, 100};
+
+/// Cada cenário conferido com calculaCPM sobre o grafo com as suas
+/// durações (negativas contam zero, como no lote)
+void comparaCPM(const std::string &caso, const Grafo &grafo, const LoteCenarios &lote,
+                const ResultadoCenarios &resultado) {
+
+    Grafo cenario = grafo;
+
+    for (size_t c = 0; c < lote.cenarios; ++c) {
+        for (AtvId v = 0; v < grafo.tamanho(); ++v) {
+            if (v == grafo.inicio || v == grafo.fim) continue;
+            cenario.peso[v] = std::max(0, lote.duracao[v * lote.cenarios + c]);
+        }
+
+        Cronograma cronograma;
+        if (!calculaCPM(cronograma, cenario)) {
+            confere(false, caso, "calculaCPM falhou");
+            return;
+        }
+
+        const auto atual = caso + " cenario " + std::to_string(c);
+        confere(resultado.duracaoProjeto[c] == cronograma.duracao, atual,
+                "duracao " + std::to_string(resultado.duracaoProjeto[c]) + ", esperada " +
+                std::to_string(cronograma.duracao));
+
+        for (AtvId v = 0; v < grafo.tamanho(); ++v) {
+            const auto atv = " de " + grafo.nomes[v];
+            confere(resultado.ef(v, c) == cronograma.earlyFinish[v], atual, "EF" + atv);
+            confere(resultado.lf(v, c) == cronograma.lateFinish[v], atual, "LF" + atv);
+            confere(resultado.folga(v, c) == cronograma.slack[v], atual, "slack" + atv);
+        }
+    }
+}
+
+/// Resultado vetorial idêntico ao escalar, elemento a elemento
+void comparaEscalar(const std::string &caso, const ResultadoCenarios &resultado,
+                    const ResultadoCenarios &escalar) {
+    confere(resultado.duracaoProjeto == escalar.duracaoProjeto, caso, "duracao difere do escalar");
+    confere(resultado.earlyFinish == escalar.earlyFinish, caso, "EF difere do escalar");
+    confere(resultado.lateFinish == escalar.lateFinish, caso, "LF difere do escalar");
+    confere(resultado.slack == escalar.slack, caso, "slack difere do escalar");
+}
+
+} // namespace
+
+int main() {
+
+    const Forma formas[] = {Forma::Cadeia, Forma::Leque, Forma::Camadas, Forma::SerieParalelo};
+    const char *nomesFormas[] = {"cadeia", "leque", "camadas", "serie-paralelo"};
+    const uint32_t atividades[] = {1, 6, 40};
+
+    const auto instrucoes = instrucoesDisponiveis();
+
+    std::mt19937_64 sorteio(13);
+    size_t casos = 0;
+
+    for (size_t f = 0; f < 4; ++f) {
+        for (const auto n : atividades) {
+            ParametrosGerador parametros;
+            parametros.atividades = n;
+            parametros.densidade = 1.5;
+            parametros.forma = formas[f];
+            parametros.semente = n;
+
+            std::ostringstream texto;
+            geraProjeto(texto, parametros);
+            const auto arquivo = texto.str();
+
+            Projeto projeto;
+            ErroParse erro;
+            if (!parseProjeto(projeto, arquivo.data(), arquivo.size(), erro)) {
+                std::cerr << "ERRO: projeto gerado invalido: linha " << erro.linha << ": "
+                          << erro.mensagem << "\n";
+                return EXIT_FAILURE;
+            }
+            const auto &grafo = projeto.grafo;
+
+            for (const auto tamanho : TAMANHOS_LOTE) {
+                // Durações sorteadas, com zeros e negativas
+                LoteCenarios lote;
+                lote.inicializa(grafo, tamanho);
+                for (AtvId v = 0; v < grafo.tamanho(); ++v) {
+                    if (v == grafo.inicio || v == grafo.fim) continue;
+                    for (size_t c = 0; c < tamanho; ++c) {
+                        lote.em(v, c) = static_cast<int32_t>(sorteio() % 23) - 2;
+                    }
+                }
+
+                std::ostringstream caso;
+                caso << nomesFormas[f] << " n=" << n << " lote=" << tamanho;
+
+                usaInstrucoesCenarios("escalar");
+                ResultadoCenarios escalar;
+                if (!calculaCenarios(escalar, grafo, lote)) {
+                    confere(false, caso.str() + " escalar", "calculaCenarios falhou");
+                    continue;
+                }
+                comparaCPM(caso.str() + " escalar", grafo, lote, escalar);
+
+                for (const auto nome : instrucoes) {
+                    if (!usaInstrucoesCenarios(nome)) {
+                        confere(false, caso.str(), std::string("instrucoes ") + nome + " recusadas");
+                        continue;
+                    }
+                    const auto atual = caso.str() + " " + nome;
+
+                    ResultadoCenarios resultado;
+                    if (!calculaCenarios(resultado, grafo, lote)) {
+                        confere(false, atual, "calculaCenarios falhou");
+                        continue;
+                    }
+                    comparaEscalar(atual, resultado, escalar);
+                    comparaCPM(atual, grafo, lote, resultado);
+                    ++casos;
+                }
+            }
+        }
+    }
+
+    std::cout << "cenarios (";
+    for (size_t i = 0; i < instrucoes.size(); ++i) std::cout << (i ? ", " : "") << instrucoes[i];
+    std::cout << "): " << casos << " lote(s), " << falhas << " falha(s)\n";
+    return 0 == falhas ? EXIT_SUCCESS : EXIT_FAILURE;
+}
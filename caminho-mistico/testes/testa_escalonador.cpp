@@ -0,0 +1,232 @@
+/// Calculador de Caminho Critico
+/// Teste: reprogramação incremental conferida com o recálculo completo
+///
+/// Universidade Federal do Parana
+/// Setor de Engenharia Elétrica
+/// Gerencia de Projetos - TE064
+///
+
+#include <algorithm>    // max
+#include <cstdlib>      // EXIT_SUCCESS, EXIT_FAILURE
+#include <iostream>     // cout, cerr
+#include <random>       // mt19937_64
+#include <sstream>      // ostringstream
+#include <string>       // string
+#include <vector>       // vector
+
+#include "cpm.h"        // calculaCPM, ordenaTopologica
+#include "execucao.h"   // Execucao
+#include "gerador.h"    // geraProjeto
+#include "parser.h"     // parseProjeto
+
+namespace {
+
+/// Falhas encontradas (somente as primeiras são descritas em stderr)
+int falhas = 0;
+
+void confere(bool condicao, const std::string &caso, const std::string &descricao) {
+    if (condicao) return;
+    if (++falhas <= 20) std::cerr << "FALHA [" << caso << "]: " << descricao << "\n";
+}
+
+/// Estado real acompanhado pelo teste, independente do escalonador
+struct Reais {
+    std::vector<int> inicio;
+    std::vector<int> fim;
+    std::vector<int> peso;
+};
+
+/// Alteração de duração aplicada antes de um dia (atividade ATV_NULA: nenhuma)
+struct Alteracao {
+    AtvId atividade = ATV_NULA;
+    int dias = 0;
+};
+
+/// Aplica os eventos do dia como Execucao::processaDia: términos, depois inícios
+void aplica(Reais &reais, const Day &d) {
+    for (const auto v : d.finalizadas) reais.fim[v] = d.dia;
+    for (const auto v : d.iniciadas) reais.inicio[v] = d.dia;
+}
+
+/// Recalcula tudo e compara com o escalonador
+///     - ida: ES/EF em ordem topológica a partir das datas reais
+///     - volta: calculaCPM sobre uma cópia do grafo com as durações
+///       efetivas; a cauda (duração + 1 - LS) dá o LS esperado
+void compara(const std::string &caso, const Grafo &grafo, const std::vector<AtvId> &ordem,
+             const Reais &reais, const Escalonador &dinamico) {
+
+    const auto n = grafo.tamanho();
+    std::vector<int> es(n, 0);
+    std::vector<int> ef(n, 0);
+
+    for (const auto v : ordem) {
+        int inicio = 1;
+        if (reais.inicio[v]) {
+            inicio = reais.inicio[v];
+        } else if (v != grafo.inicio) {
+            for (auto a = grafo.antBegin(v); a != grafo.antEnd(v); ++a) {
+                if (*a != grafo.fim) inicio = std::max(inicio, ef[*a]);
+            }
+        }
+        es[v] = inicio;
+        ef[v] = reais.fim[v] ? reais.fim[v] : inicio + std::max(0, reais.peso[v]);
+    }
+
+    Grafo efetivo = grafo;
+    for (AtvId v = 0; v < n; ++v) {
+        if (grafo.peso[v] < 0) continue; // extremos
+        efetivo.peso[v] = reais.fim[v] ? std::max(0, ef[v] - es[v]) : std::max(0, reais.peso[v]);
+    }
+
+    Cronograma completo;
+    if (!calculaCPM(completo, efetivo)) {
+        confere(false, caso, "calculaCPM falhou");
+        return;
+    }
+
+    const int duracao = es[grafo.fim] - 1;
+    confere(dinamico.duracao() == duracao, caso,
+            "duracao " + std::to_string(dinamico.duracao()) + ", esperada " + std::to_string(duracao));
+
+    for (AtvId v = 0; v < n; ++v) {
+        const std::string atv = " de " + grafo.nomes[v];
+        const int cauda = completo.duracao + 1 - completo.lateStart[v];
+        const int lateStart = duracao + 1 - cauda;
+
+        confere(dinamico.earlyStart(v) == es[v], caso, "ES" + atv + " " +
+                std::to_string(dinamico.earlyStart(v)) + ", esperado " + std::to_string(es[v]));
+        confere(dinamico.earlyFinish(v) == ef[v], caso, "EF" + atv + " " +
+                std::to_string(dinamico.earlyFinish(v)) + ", esperado " + std::to_string(ef[v]));
+        confere(dinamico.lateStart(v) == lateStart, caso, "LS" + atv + " " +
+                std::to_string(dinamico.lateStart(v)) + ", esperado " + std::to_string(lateStart));
+    }
+}
+
+/// Reproduz os dias a partir de `primeiro`, conferindo após cada um
+void reproduz(const std::string &caso, const Projeto &projeto, const std::vector<AtvId> &ordem,
+              const std::vector<Alteracao> &alteracoes, size_t primeiro,
+              Execucao &execucao, Reais &reais,
+              std::vector<Execucao::Ponto> *pontos, std::vector<Reais> *estados) {
+
+    std::ostringstream alertas;
+
+    for (size_t i = primeiro; i < projeto.dias.size(); ++i) {
+        if (pontos && 0 == i % 3) {
+            pontos->emplace_back();
+            execucao.salva(pontos->back());
+            estados->push_back(reais);
+        }
+
+        const auto &alteracao = alteracoes[i];
+        if (alteracao.atividade != ATV_NULA) {
+            execucao.redefineDuracao(alteracao.atividade, alteracao.dias);
+            reais.peso[alteracao.atividade] = alteracao.dias;
+        }
+
+        // Alterna entre somente aplicar os eventos e emitir os alertas
+        execucao.processaDia(projeto.dias[i], (i % 2) ? &alertas : nullptr);
+        aplica(reais, projeto.dias[i]);
+
+        compara(caso + " dia " + std::to_string(projeto.dias[i].dia), projeto.grafo, ordem,
+                reais, execucao.escalonador());
+    }
+}
+
+/// Reprodução completa, depois retorno a pontos salvos e nova reprodução
+/// a partir de cada um
+void testaProjeto(const std::string &caso, const Projeto &projeto, std::mt19937_64 &sorteio) {
+
+    const auto &grafo = projeto.grafo;
+
+    std::vector<AtvId> ordem;
+    Cronograma cronograma;
+    if (!ordenaTopologica(ordem, grafo) || !calculaCPM(cronograma, grafo)) {
+        confere(false, caso, "projeto gerado com ciclo");
+        return;
+    }
+
+    // Durações redefinidas ("e se") em alguns dias, iguais em todas as reproduções
+    std::vector<Alteracao> alteracoes(projeto.dias.size());
+    for (auto &alteracao : alteracoes) {
+        if (0 != sorteio() % 4) continue;
+        const auto v = static_cast<AtvId>(sorteio() % grafo.tamanho());
+        if (grafo.peso[v] < 0) continue;
+        alteracao.atividade = v;
+        alteracao.dias = static_cast<int>(sorteio() % 5);
+    }
+
+    Execucao execucao;
+    if (!execucao.inicializa(grafo, cronograma)) {
+        confere(false, caso, "inicializa falhou");
+        return;
+    }
+
+    Reais reais;
+    reais.inicio.assign(grafo.tamanho(), 0);
+    reais.fim.assign(grafo.tamanho(), 0);
+    reais.peso = grafo.peso;
+
+    compara(caso + " inicial", grafo, ordem, reais, execucao.escalonador());
+
+    std::vector<Execucao::Ponto> pontos;
+    std::vector<Reais> estados;
+    reproduz(caso, projeto, ordem, alteracoes, 0, execucao, reais, &pontos, &estados);
+
+    // Do fim para o início e de volta: cada restauração parte de um estado
+    // posterior ao ponto restaurado
+    for (size_t p = pontos.size(); p-- > 0;) {
+        const auto ponto = caso + " ponto " + std::to_string(p);
+        execucao.restaura(pontos[p], cronograma);
+        compara(ponto, grafo, ordem, estados[p], execucao.escalonador());
+
+        reais = estados[p];
+        reproduz(ponto, projeto, ordem, alteracoes, p * 3, execucao, reais, nullptr, nullptr);
+    }
+}
+
+} // namespace
+
+int main() {
+
+    const Forma formas[] = {Forma::Cadeia, Forma::Leque, Forma::Camadas, Forma::SerieParalelo};
+    const char *nomesFormas[] = {"cadeia", "leque", "camadas", "serie-paralelo"};
+    const uint32_t tamanhos[] = {1, 5, 20, 60};
+
+    std::mt19937_64 sorteio(11);
+    size_t casos = 0;
+
+    for (size_t f = 0; f < 4; ++f) {
+        for (const auto n : tamanhos) {
+            for (uint64_t semente = 1; semente <= 4; ++semente) {
+                ParametrosGerador parametros;
+                parametros.atividades = n;
+                parametros.densidade = 1.5;
+                parametros.forma = formas[f];
+                parametros.dias = 3 * n + 10;
+                parametros.atrasoMaximo = static_cast<int>(semente);
+                parametros.semente = semente;
+                parametros.tresPontos = (0 == semente % 2);
+
+                std::ostringstream texto;
+                geraProjeto(texto, parametros);
+                const auto arquivo = texto.str();
+
+                Projeto projeto;
+                ErroParse erro;
+                if (!parseProjeto(projeto, arquivo.data(), arquivo.size(), erro)) {
+                    std::cerr << "ERRO: projeto gerado invalido: linha " << erro.linha << ": "
+                              << erro.mensagem << "\n";
+                    return EXIT_FAILURE;
+                }
+
+                std::ostringstream caso;
+                caso << nomesFormas[f] << " n=" << n << " s=" << semente;
+                testaProjeto(caso.str(), projeto, sorteio);
+                ++casos;
+            }
+        }
+    }
+
+    std::cout << "escalonador: " << casos << " projeto(s), " << falhas << " falha(s)\n";
+    return 0 == falhas ? EXIT_SUCCESS : EXIT_FAILURE;
+}